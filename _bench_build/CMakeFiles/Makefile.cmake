@@ -0,0 +1,117 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/bench/CMakeLists.txt"
+  "/root/repo/cmake/Config.cmake.in"
+  "/root/repo/test/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "levelz-cppConfigVersion.cmake"
+  "levelz-cppConfig.cmake"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "DartConfiguration.tcl"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "test/CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "test/CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "test/CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "test/CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "test/CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "test/CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "test/CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "test/CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "test/CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "test/CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "test/CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "test/CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "test/CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "test/CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "test/CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "test/CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "test/CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "test/CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "test/CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "test/CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "test/CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "test/CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "test/CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "test/CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "test/CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "test/CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "test/CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "test/CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "test/CMakeFiles/levelz-test-coordinate.dir/DependInfo.cmake"
+  "test/CMakeFiles/levelz-test-block.dir/DependInfo.cmake"
+  "test/CMakeFiles/levelz-test-level.dir/DependInfo.cmake"
+  "test/CMakeFiles/levelz-test-matrix.dir/DependInfo.cmake"
+  "test/CMakeFiles/levelz-test-transform.dir/DependInfo.cmake"
+  "test/CMakeFiles/levelz-test-diff.dir/DependInfo.cmake"
+  "test/CMakeFiles/levelz-test-incremental.dir/DependInfo.cmake"
+  "test/CMakeFiles/levelz-test-generator.dir/DependInfo.cmake"
+  "test/CMakeFiles/levelz-test-instrumentation.dir/DependInfo.cmake"
+  "test/CMakeFiles/levelz-test-resource.dir/DependInfo.cmake"
+  "test/CMakeFiles/levelz-test-async.dir/DependInfo.cmake"
+  "test/CMakeFiles/levelz-test-binary.dir/DependInfo.cmake"
+  "test/CMakeFiles/levelz-test-cache.dir/DependInfo.cmake"
+  "bench/CMakeFiles/levelz-bench.dir/DependInfo.cmake"
+  )
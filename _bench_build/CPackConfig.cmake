@@ -0,0 +1,113 @@
+# This file will be configured to contain variables for CPack. These variables
+# should be set in the CMake list file of the project before CPack module is
+# included. The list of available CPACK_xxx variables and their associated
+# documentation may be obtained using
+#  cpack --help-variable-list
+#
+# Some variables are common to all generators (e.g. CPACK_PACKAGE_NAME)
+# and some are specific to a generator
+# (e.g. CPACK_NSIS_EXTRA_INSTALL_COMMANDS). The generator specific variables
+# usually begin with CPACK_<GENNAME>_xxxx.
+
+
+set(CPACK_BUILD_SOURCE_DIRS "/root/repo;/root/repo/_bench_build")
+set(CPACK_CMAKE_GENERATOR "Unix Makefiles")
+set(CPACK_COMPONENTS_ALL "Unspecified;library")
+set(CPACK_COMPONENT_UNSPECIFIED_HIDDEN "TRUE")
+set(CPACK_COMPONENT_UNSPECIFIED_REQUIRED "TRUE")
+set(CPACK_DEBIAN_PACKAGE_MAINTAINER "Gregory Mitchell <me@gmitch215.xyz>")
+set(CPACK_DEFAULT_PACKAGE_DESCRIPTION_FILE "/usr/share/cmake-3.25/Templates/CPack.GenericDescription.txt")
+set(CPACK_DEFAULT_PACKAGE_DESCRIPTION_SUMMARY "levelz-cpp built using CMake")
+set(CPACK_DMG_SLA_USE_RESOURCE_FILE_LICENSE "ON")
+set(CPACK_GENERATOR "TGZ;TXZ;DEB;RPM")
+set(CPACK_INSTALL_CMAKE_PROJECTS "/root/repo/_bench_build;levelz-cpp;ALL;/")
+set(CPACK_INSTALL_PREFIX "/usr")
+set(CPACK_MODULE_PATH "")
+set(CPACK_NSIS_DISPLAY_NAME "levelz-cpp")
+set(CPACK_NSIS_INSTALLER_ICON_CODE "")
+set(CPACK_NSIS_INSTALLER_MUI_ICON_CODE "")
+set(CPACK_NSIS_INSTALL_ROOT "$PROGRAMFILES")
+set(CPACK_NSIS_PACKAGE_NAME "levelz-cpp")
+set(CPACK_NSIS_UNINSTALL_NAME "Uninstall")
+set(CPACK_OBJCOPY_EXECUTABLE "/usr/bin/objcopy")
+set(CPACK_OBJDUMP_EXECUTABLE "/usr/bin/objdump")
+set(CPACK_OUTPUT_CONFIG_FILE "/root/repo/_bench_build/CPackConfig.cmake")
+set(CPACK_PACKAGE_CHECKSUM "SHA256")
+set(CPACK_PACKAGE_CONTACT "me@gmitch215.xyz")
+set(CPACK_PACKAGE_DEFAULT_LOCATION "/")
+set(CPACK_PACKAGE_DESCRIPTION "C++ implementation of the LevelZ File Format")
+set(CPACK_PACKAGE_DESCRIPTION_FILE "/usr/share/cmake-3.25/Templates/CPack.GenericDescription.txt")
+set(CPACK_PACKAGE_DESCRIPTION_SUMMARY "C++ implementation of the LevelZ File Format")
+set(CPACK_PACKAGE_DIRECTORY "/root/repo/_bench_build/build/package")
+set(CPACK_PACKAGE_FILE_NAME "levelz-cpp-0.3.0-linux-x64")
+set(CPACK_PACKAGE_HOMEPAGE_URL "https://github.com/LevelZ-File/cpp-bindings")
+set(CPACK_PACKAGE_INSTALL_DIRECTORY "levelz-cpp")
+set(CPACK_PACKAGE_INSTALL_REGISTRY_KEY "levelz-cpp")
+set(CPACK_PACKAGE_NAME "levelz-cpp")
+set(CPACK_PACKAGE_RELOCATABLE "true")
+set(CPACK_PACKAGE_VENDOR "Gregory Mitchell")
+set(CPACK_PACKAGE_VERSION "0.3.0")
+set(CPACK_PACKAGE_VERSION_MAJOR "0")
+set(CPACK_PACKAGE_VERSION_MINOR "3")
+set(CPACK_PACKAGE_VERSION_PATCH "0")
+set(CPACK_READELF_EXECUTABLE "/usr/bin/readelf")
+set(CPACK_RESOURCE_FILE_LICENSE "/root/repo/LICENSE")
+set(CPACK_RESOURCE_FILE_README "/usr/share/cmake-3.25/Templates/CPack.GenericDescription.txt")
+set(CPACK_RESOURCE_FILE_WELCOME "/usr/share/cmake-3.25/Templates/CPack.GenericWelcome.txt")
+set(CPACK_RPM_PACKAGE_LICENSE "MIT")
+set(CPACK_SET_DESTDIR "OFF")
+set(CPACK_SOURCE_GENERATOR "TBZ2;TGZ;TXZ;TZ")
+set(CPACK_SOURCE_OUTPUT_CONFIG_FILE "/root/repo/_bench_build/CPackSourceConfig.cmake")
+set(CPACK_SOURCE_RPM "OFF")
+set(CPACK_SOURCE_TBZ2 "ON")
+set(CPACK_SOURCE_TGZ "ON")
+set(CPACK_SOURCE_TXZ "ON")
+set(CPACK_SOURCE_TZ "ON")
+set(CPACK_SOURCE_ZIP "OFF")
+set(CPACK_SYSTEM_NAME "linux-x64")
+set(CPACK_THREADS "0")
+set(CPACK_TOPLEVEL_TAG "linux-x64")
+set(CPACK_WIX_SIZEOF_VOID_P "8")
+
+if(NOT CPACK_PROPERTIES_FILE)
+  set(CPACK_PROPERTIES_FILE "/root/repo/_bench_build/CPackProperties.cmake")
+endif()
+
+if(EXISTS ${CPACK_PROPERTIES_FILE})
+  include(${CPACK_PROPERTIES_FILE})
+endif()
+
+# Configuration for component "library"
+
+SET(CPACK_COMPONENTS_ALL Unspecified library)
+set(CPACK_COMPONENT_LIBRARY_DISPLAY_NAME "LevelZ C++ Library")
+set(CPACK_COMPONENT_LIBRARY_DESCRIPTION "The core library")
+set(CPACK_COMPONENT_LIBRARY_REQUIRED TRUE)
+
+# Configuration for component "attribution"
+
+SET(CPACK_COMPONENTS_ALL Unspecified library)
+set(CPACK_COMPONENT_ATTRIBUTION_DISPLAY_NAME "Attribution")
+set(CPACK_COMPONENT_ATTRIBUTION_DESCRIPTION "Attribution files")
+set(CPACK_COMPONENT_ATTRIBUTION_REQUIRED TRUE)
+
+# Configuration for component group "docs"
+set(CPACK_COMPONENT_GROUP_DOCS_DISPLAY_NAME "Documentation")
+set(CPACK_COMPONENT_GROUP_DOCS_DESCRIPTION "Documentation for the library")
+set(CPACK_COMPONENT_GROUP_DOCS_EXPANDED TRUE)
+
+# Configuration for component "htmlDocs"
+
+SET(CPACK_COMPONENTS_ALL Unspecified library)
+set(CPACK_COMPONENT_HTMLDOCS_DISPLAY_NAME "HTML Documentation")
+set(CPACK_COMPONENT_HTMLDOCS_DESCRIPTION "HTML documentation")
+set(CPACK_COMPONENT_HTMLDOCS_GROUP docs)
+set(CPACK_COMPONENT_HTMLDOCS_DISABLED TRUE)
+
+# Configuration for component "latexDocs"
+
+SET(CPACK_COMPONENTS_ALL Unspecified library)
+set(CPACK_COMPONENT_LATEXDOCS_DISPLAY_NAME "LaTeX Documentation")
+set(CPACK_COMPONENT_LATEXDOCS_DESCRIPTION "LaTeX documentation")
+set(CPACK_COMPONENT_LATEXDOCS_GROUP docs)
+set(CPACK_COMPONENT_LATEXDOCS_DISABLED TRUE)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../build/bin/levelz-bench"
+  "../build/bin/levelz-bench.pdb"
+  "CMakeFiles/levelz-bench.dir/src/bench.cpp.o"
+  "CMakeFiles/levelz-bench.dir/src/bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/levelz-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../build/bin/levelz-test-async"
+  "../build/bin/levelz-test-async.pdb"
+  "CMakeFiles/levelz-test-async.dir/src/async.cpp.o"
+  "CMakeFiles/levelz-test-async.dir/src/async.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/levelz-test-async.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
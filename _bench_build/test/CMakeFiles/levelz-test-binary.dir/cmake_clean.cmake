@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../build/bin/levelz-test-binary"
+  "../build/bin/levelz-test-binary.pdb"
+  "CMakeFiles/levelz-test-binary.dir/src/binary.cpp.o"
+  "CMakeFiles/levelz-test-binary.dir/src/binary.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/levelz-test-binary.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
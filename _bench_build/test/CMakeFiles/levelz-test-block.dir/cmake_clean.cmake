@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../build/bin/levelz-test-block"
+  "../build/bin/levelz-test-block.pdb"
+  "CMakeFiles/levelz-test-block.dir/src/block.cpp.o"
+  "CMakeFiles/levelz-test-block.dir/src/block.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/levelz-test-block.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../build/bin/levelz-test-cache"
+  "../build/bin/levelz-test-cache.pdb"
+  "CMakeFiles/levelz-test-cache.dir/src/cache.cpp.o"
+  "CMakeFiles/levelz-test-cache.dir/src/cache.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/levelz-test-cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
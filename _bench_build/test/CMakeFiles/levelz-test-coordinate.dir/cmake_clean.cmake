@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../build/bin/levelz-test-coordinate"
+  "../build/bin/levelz-test-coordinate.pdb"
+  "CMakeFiles/levelz-test-coordinate.dir/src/coordinate.cpp.o"
+  "CMakeFiles/levelz-test-coordinate.dir/src/coordinate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/levelz-test-coordinate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../build/bin/levelz-test-diff"
+  "../build/bin/levelz-test-diff.pdb"
+  "CMakeFiles/levelz-test-diff.dir/src/diff.cpp.o"
+  "CMakeFiles/levelz-test-diff.dir/src/diff.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/levelz-test-diff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
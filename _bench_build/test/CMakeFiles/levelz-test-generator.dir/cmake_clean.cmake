@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../build/bin/levelz-test-generator"
+  "../build/bin/levelz-test-generator.pdb"
+  "CMakeFiles/levelz-test-generator.dir/src/generator.cpp.o"
+  "CMakeFiles/levelz-test-generator.dir/src/generator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/levelz-test-generator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
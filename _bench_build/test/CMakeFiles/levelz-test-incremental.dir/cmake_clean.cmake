@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../build/bin/levelz-test-incremental"
+  "../build/bin/levelz-test-incremental.pdb"
+  "CMakeFiles/levelz-test-incremental.dir/src/incremental.cpp.o"
+  "CMakeFiles/levelz-test-incremental.dir/src/incremental.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/levelz-test-incremental.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../build/bin/levelz-test-instrumentation"
+  "../build/bin/levelz-test-instrumentation.pdb"
+  "CMakeFiles/levelz-test-instrumentation.dir/src/instrumentation.cpp.o"
+  "CMakeFiles/levelz-test-instrumentation.dir/src/instrumentation.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/levelz-test-instrumentation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../build/bin/levelz-test-level"
+  "../build/bin/levelz-test-level.pdb"
+  "CMakeFiles/levelz-test-level.dir/src/level.cpp.o"
+  "CMakeFiles/levelz-test-level.dir/src/level.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/levelz-test-level.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../build/bin/levelz-test-matrix"
+  "../build/bin/levelz-test-matrix.pdb"
+  "CMakeFiles/levelz-test-matrix.dir/src/matrix.cpp.o"
+  "CMakeFiles/levelz-test-matrix.dir/src/matrix.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/levelz-test-matrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
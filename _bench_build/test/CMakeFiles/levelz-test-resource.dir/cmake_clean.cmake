@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../build/bin/levelz-test-resource"
+  "../build/bin/levelz-test-resource.pdb"
+  "CMakeFiles/levelz-test-resource.dir/src/resource.cpp.o"
+  "CMakeFiles/levelz-test-resource.dir/src/resource.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/levelz-test-resource.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../build/bin/levelz-test-transform"
+  "../build/bin/levelz-test-transform.pdb"
+  "CMakeFiles/levelz-test-transform.dir/src/transform.cpp.o"
+  "CMakeFiles/levelz-test-transform.dir/src/transform.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/levelz-test-transform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
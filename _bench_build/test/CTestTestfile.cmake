@@ -0,0 +1,32 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_bench_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(coordinate.h "/root/repo/_bench_build/build/bin/levelz-test-coordinate")
+set_tests_properties(coordinate.h PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;16;add_test;/root/repo/test/CMakeLists.txt;25;add_test_executable;/root/repo/test/CMakeLists.txt;0;")
+add_test(block.h "/root/repo/_bench_build/build/bin/levelz-test-block")
+set_tests_properties(block.h PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;16;add_test;/root/repo/test/CMakeLists.txt;26;add_test_executable;/root/repo/test/CMakeLists.txt;0;")
+add_test(level.h "/root/repo/_bench_build/build/bin/levelz-test-level")
+set_tests_properties(level.h PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;16;add_test;/root/repo/test/CMakeLists.txt;27;add_test_executable;/root/repo/test/CMakeLists.txt;0;")
+add_test(matrix.h "/root/repo/_bench_build/build/bin/levelz-test-matrix")
+set_tests_properties(matrix.h PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;16;add_test;/root/repo/test/CMakeLists.txt;28;add_test_executable;/root/repo/test/CMakeLists.txt;0;")
+add_test(transform.h "/root/repo/_bench_build/build/bin/levelz-test-transform")
+set_tests_properties(transform.h PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;16;add_test;/root/repo/test/CMakeLists.txt;29;add_test_executable;/root/repo/test/CMakeLists.txt;0;")
+add_test(diff.h "/root/repo/_bench_build/build/bin/levelz-test-diff")
+set_tests_properties(diff.h PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;16;add_test;/root/repo/test/CMakeLists.txt;30;add_test_executable;/root/repo/test/CMakeLists.txt;0;")
+add_test(incremental.h "/root/repo/_bench_build/build/bin/levelz-test-incremental")
+set_tests_properties(incremental.h PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;16;add_test;/root/repo/test/CMakeLists.txt;31;add_test_executable;/root/repo/test/CMakeLists.txt;0;")
+add_test(generator.h "/root/repo/_bench_build/build/bin/levelz-test-generator")
+set_tests_properties(generator.h PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;16;add_test;/root/repo/test/CMakeLists.txt;32;add_test_executable;/root/repo/test/CMakeLists.txt;0;")
+add_test(instrumentation.h "/root/repo/_bench_build/build/bin/levelz-test-instrumentation")
+set_tests_properties(instrumentation.h PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;16;add_test;/root/repo/test/CMakeLists.txt;33;add_test_executable;/root/repo/test/CMakeLists.txt;0;")
+add_test(resource.h "/root/repo/_bench_build/build/bin/levelz-test-resource")
+set_tests_properties(resource.h PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;16;add_test;/root/repo/test/CMakeLists.txt;34;add_test_executable;/root/repo/test/CMakeLists.txt;0;")
+add_test(async.h "/root/repo/_bench_build/build/bin/levelz-test-async")
+set_tests_properties(async.h PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;16;add_test;/root/repo/test/CMakeLists.txt;35;add_test_executable;/root/repo/test/CMakeLists.txt;0;")
+add_test(binary.h "/root/repo/_bench_build/build/bin/levelz-test-binary")
+set_tests_properties(binary.h PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;16;add_test;/root/repo/test/CMakeLists.txt;41;add_test_executable;/root/repo/test/CMakeLists.txt;0;")
+add_test(cache.h "/root/repo/_bench_build/build/bin/levelz-test-cache")
+set_tests_properties(cache.h PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;16;add_test;/root/repo/test/CMakeLists.txt;42;add_test_executable;/root/repo/test/CMakeLists.txt;0;")
@@ -0,0 +1,213 @@
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <filesystem>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "levelz.hpp"
+
+// Allocation Counting
+
+static std::atomic<size_t> allocations{0};
+
+void* operator new(size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+struct AllocationCounter {
+    benchmark::State& state;
+    size_t start;
+
+    explicit AllocationCounter(benchmark::State& state) : state(state), start(allocations.load(std::memory_order_relaxed)) {}
+
+    ~AllocationCounter() {
+        size_t count = allocations.load(std::memory_order_relaxed) - start;
+        state.counters["allocs/op"] = benchmark::Counter(static_cast<double>(count), benchmark::Counter::kAvgIterations);
+    }
+};
+
+// Synthetic Levels
+
+static std::vector<std::string> generate(bool is2D, size_t lines, double matrixRatio) {
+    LevelZ::GeneratorOptions options;
+    options.is2D = is2D;
+    options.lines = lines;
+    options.seed = 215;
+    options.matrixRatio = matrixRatio;
+    options.matrixSize = is2D ? 10 : 5;
+    options.properties = 2;
+    options.commentDensity = 0.01;
+
+    return readContentLines(LevelZ::generateContents(options));
+}
+
+static size_t bytes(const std::vector<std::string>& lines) {
+    size_t total = 0;
+    for (const std::string& line : lines) total += line.size() + 1;
+    return total;
+}
+
+static std::string join(const std::vector<std::string>& lines) {
+    std::string contents;
+    contents.reserve(bytes(lines));
+    for (const std::string& line : lines) contents += line + "\n";
+    return contents;
+}
+
+static const std::vector<std::string>& level(int index) {
+    static const std::vector<std::string> levels[] = {
+        generate(true, 100, 0),
+        generate(true, 1000000, 0),
+        generate(true, 10000, 1),
+        generate(false, 10000, 1)
+    };
+
+    return levels[index];
+}
+
+static void args(benchmark::internal::Benchmark* b) {
+    b->ArgName("level")->Arg(0)->Arg(1)->Arg(2)->Arg(3)->Unit(benchmark::kMillisecond);
+}
+
+// Parsing
+
+static void BM_parseLines(benchmark::State& state) {
+    const std::vector<std::string>& lines = level(static_cast<int>(state.range(0)));
+    AllocationCounter counter(state);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(LevelZ::parseLines(lines));
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes(lines)));
+}
+BENCHMARK(BM_parseLines)->Apply(args);
+
+static void BM_parseContents(benchmark::State& state) {
+    const std::string contents = join(level(static_cast<int>(state.range(0))));
+    AllocationCounter counter(state);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(LevelZ::parseContents(contents));
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * contents.size()));
+}
+BENCHMARK(BM_parseContents)->Apply(args);
+
+static void BM_parseContents_arena(benchmark::State& state) {
+    const std::string contents = join(level(static_cast<int>(state.range(0))));
+    AllocationCounter counter(state);
+
+    for (auto _ : state) {
+        std::pmr::monotonic_buffer_resource arena;
+        LevelZ::ParseOptions options;
+        options.resource = &arena;
+        benchmark::DoNotOptimize(LevelZ::parseContents(contents, options));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * contents.size()));
+}
+BENCHMARK(BM_parseContents_arena)->Apply(args);
+
+static void BM_parseFile(benchmark::State& state) {
+    const std::string contents = join(level(static_cast<int>(state.range(0))));
+    const std::string file = (std::filesystem::temp_directory_path() / ("levelz-bench-" + std::to_string(state.range(0)) + ".lvlz")).string();
+    std::ofstream(file) << contents;
+
+    {
+        AllocationCounter counter(state);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(LevelZ::parseFile(file));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * contents.size()));
+    std::filesystem::remove(file);
+}
+BENCHMARK(BM_parseFile)->Apply(args);
+
+static void BM_LevelCache_load(benchmark::State& state) {
+    const std::string contents = join(level(static_cast<int>(state.range(0))));
+    const std::filesystem::path root = std::filesystem::temp_directory_path() / ("levelz-bench-cache-" + std::to_string(state.range(0)));
+    const std::string file = (root / "level.lvlz").string();
+    std::filesystem::create_directories(root);
+    std::ofstream(file) << contents;
+
+    LevelZ::LevelCache cache(root / "cache");
+    cache.load(file);
+
+    {
+        AllocationCounter counter(state);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(cache.load(file));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * contents.size()));
+    std::filesystem::remove_all(root);
+}
+BENCHMARK(BM_LevelCache_load)->Apply(args);
+
+// Data Types
+
+static void BM_CoordinateMatrix2D_from_string(benchmark::State& state) {
+    const std::string matrix = "(0, 9, -4, 12)^[-15, 32]";
+    AllocationCounter counter(state);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(LevelZ::CoordinateMatrix2D::from_string(matrix));
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * matrix.size()));
+}
+BENCHMARK(BM_CoordinateMatrix2D_from_string);
+
+static void BM_CoordinateMatrix3D_from_string(benchmark::State& state) {
+    const std::string matrix = "(0, 9, -4, 12, 2, 5)^[-15, 32, 7]";
+    AllocationCounter counter(state);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(LevelZ::CoordinateMatrix3D::from_string(matrix));
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * matrix.size()));
+}
+BENCHMARK(BM_CoordinateMatrix3D_from_string);
+
+static void BM_readBlock(benchmark::State& state) {
+    const std::string block = "stone<cracked=false, hardness=3, color=gray>";
+    AllocationCounter counter(state);
+
+    for (auto _ : state) {
+        std::string input = block;
+        benchmark::DoNotOptimize(readBlock(input));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * block.size()));
+}
+BENCHMARK(BM_readBlock);
+
+static void BM_Level_copy(benchmark::State& state) {
+    const LevelZ::Level2D level = static_cast<LevelZ::Level2D>(LevelZ::parseLines(::level(static_cast<int>(state.range(0)))));
+    AllocationCounter counter(state);
+
+    for (auto _ : state) {
+        LevelZ::Level2D copy(level);
+        benchmark::DoNotOptimize(copy);
+    }
+
+    state.counters["blocks"] = static_cast<double>(level.blocks().size());
+}
+BENCHMARK(BM_Level_copy)->ArgName("level")->Arg(0)->Arg(1)->Arg(2)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
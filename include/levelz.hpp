@@ -7,14 +7,57 @@
 #include <cstdio>
 #include <unordered_map>
 #include <algorithm>
-#include <regex>
+#include <chrono>
+#include <charconv>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <memory_resource>
 
 #include "levelz/coordinate.hpp"
 #include "levelz/block.hpp"
 #include "levelz/level.hpp"
+#include "levelz/spatial.hpp"
+#include "levelz/world.hpp"
+#include "levelz/prefab.hpp"
+#include "levelz/raycast.hpp"
+#include "levelz/mesh.hpp"
+#include "levelz/navigation.hpp"
+#include "levelz/lod.hpp"
 #include "levelz/matrix.hpp"
-
+#include "levelz/transform.hpp"
+#include "levelz/diff.hpp"
+#include "levelz/shared.hpp"
+#include "levelz/writer.hpp"
+#include "levelz/generator.hpp"
+#include "levelz/instrumentation.hpp"
+
+// Build Configuration
+
+/**
+ * LEVELZ_COMPILED is defined by the levelz-cpp-static and levelz-cpp-shared targets, which compile the parser once in src/levelz.cpp.
+ * Without it, the library is header-only and the parser is defined inline in every translation unit that includes it.
+ */
+#ifdef LEVELZ_COMPILED
+#define LEVELZ_INLINE
+#else
+#define LEVELZ_INLINE inline
+#endif
+
+#if defined(_WIN32) && defined(LEVELZ_SHARED)
+#ifdef LEVELZ_IMPLEMENTATION
+#define LEVELZ_API __declspec(dllexport)
+#else
+#define LEVELZ_API __declspec(dllimport)
+#endif
+#else
+#define LEVELZ_API
+#endif
+
+// Define LEVELZ_NO_USING_NAMESPACE to keep the LevelZ namespace out of the global namespace
+#ifndef LEVELZ_NO_USING_NAMESPACE
 using namespace LevelZ;
+#endif
 
 // Internal
 
@@ -30,163 +73,257 @@ namespace LevelZ {
      */
     const std::string END = "end";
 
+    /**
+     * Options for parsing a level.
+     */
+    struct ParseOptions {
+        /**
+         * Whether to remove blocks placed at the same coordinate as a later block, keeping the later one.
+         */
+        bool deduplicate = false;
+
+        /**
+         * Statistics to fill in about the parse, or nullptr to skip collecting them.
+         */
+        ParseStats* stats = nullptr;
+
+        /**
+         * The observer to notify as each stage of the parse finishes, or nullptr for none.
+         */
+        ParseObserver* observer = nullptr;
+
+        /**
+         * The memory resource to allocate the lines, temporaries and blocks of the level from, or nullptr for the default resource.
+         *
+         * The parsed level keeps its blocks in this resource, so it must outlive the level. A std::pmr::monotonic_buffer_resource
+         * lets a level and everything allocated while parsing it be released at once. Blocks' names and properties still use the global heap.
+         */
+        std::pmr::memory_resource* resource = nullptr;
+
+        /**
+         * Whether to reorder the blocks along a Morton (Z-order) curve after parsing, as with sortMorton, instead of keeping file order.
+         */
+        bool spatialOrder = false;
+    };
+
+    /**
+     * Constructs levels from parsed headers and blocks, taking over the blocks without copying them.
+     */
+    struct LevelBuilder {
+        public:
+            /**
+             * Builds a level, moving the blocks and their memory resource into it.
+             * @param headers The headers of the level, including its type.
+             * @param blocks The blocks of the level.
+             * @return The level.
+             */
+            static Level build(const std::unordered_map<std::string, std::string>& headers, BlockList&& blocks) {
+                Level level(std::move(blocks));
+                level.setHeaders(headers);
+                return level;
+            }
+
+            /**
+             * Builds a level with statistics computed while reading its blocks, so they are not computed again.
+             * @param headers The headers of the level, including its type.
+             * @param blocks The blocks of the level.
+             * @param stats The statistics of the blocks.
+             * @return The level.
+             */
+            static Level build(const std::unordered_map<std::string, std::string>& headers, BlockList&& blocks, LevelStats&& stats) {
+                Level level = build(headers, std::move(blocks));
+                level._stats = std::move(stats);
+                level._counted = true;
+                return level;
+            }
+    };
+
 }
 
-namespace {
+namespace LevelZ { namespace {
 
-    static std::vector<std::string> splitString(const std::string& str, const std::string& delimiter) {
-        std::string str0 = str;
+    // Collects ParseStats when ParseOptions requests them; parsing functions take a nullable pointer so disabled instrumentation costs no clock reads
+    struct ParseRecorder {
+        LevelZ::ParseStats stats;
+        LevelZ::ParseStats* target;
+        LevelZ::ParseObserver* observer;
+        size_t allocations = 0;
 
-        std::vector<std::string> parts;
-        size_t pos = 0;
-        std::string token;
-        while ((pos = str0.find(delimiter)) != std::string::npos) {
-            token = str0.substr(0, pos);
-            parts.push_back(token);
-            str0.erase(0, pos + delimiter.length());
+        explicit ParseRecorder(const LevelZ::ParseOptions& options) : target(options.stats), observer(options.observer) {
+            if (observer != nullptr) allocations = observer->allocations();
         }
-        parts.push_back(str0);
-        return parts;
-    }
 
-    static std::vector<std::vector<std::string>> split(const std::vector<std::string>& file) {
-        int index = 0;
-        for (int i = 0; i < file.size(); i++) {
-            if (file[i] == LevelZ::HEADER_END) {
-                index = i;
-                break;
-            }
+        bool enabled() const {
+            return target != nullptr || observer != nullptr;
         }
 
-        std::vector<std::string> header(file.begin(), file.begin() + index);
-        std::vector<std::string> body(file.begin() + index + 1, file.end());
+        static std::chrono::steady_clock::time_point now() {
+            return std::chrono::steady_clock::now();
+        }
 
-        return {header, body};
-    }
+        void record(LevelZ::ParseStage stage, std::chrono::steady_clock::time_point start) {
+            record(stage, std::chrono::duration_cast<std::chrono::nanoseconds>(now() - start));
+        }
+
+        void record(LevelZ::ParseStage stage, std::chrono::nanoseconds duration) {
+            stats[stage] += duration;
+            if (observer != nullptr) observer->onStage(stage, duration);
+        }
+
+        void finish() {
+            if (observer != nullptr) stats.allocations = observer->allocations() - allocations;
+            if (target != nullptr) *target = stats;
+            if (observer != nullptr) observer->onComplete(stats);
+        }
+    };
+
+    using LineList = std::pmr::vector<std::string_view>;
 
-    static std::string trim(const std::string& str) {
-        size_t first = str.find_first_not_of(' ');
-        if (std::string::npos == first) return str;
+    static std::string_view trim(std::string_view str) {
+        size_t first = str.find_first_not_of(" \t\r\n");
+        if (first == std::string_view::npos) return std::string_view();
 
-        size_t last = str.find_last_not_of(' ');
-        return str.substr(first, (last - first + 1));
+        size_t last = str.find_last_not_of(" \t\r\n");
+        return str.substr(first, last - first + 1);
     }
 
-    static std::unordered_map<std::string, std::string> readHeaders(const std::vector<std::string>& headers) {
-        std::unordered_map<std::string, std::string> map;
+    template <typename T>
+    static T readNumber(std::string_view str) {
+        str = trim(str);
+        if (!str.empty() && str[0] == '+') str.remove_prefix(1);
 
-        for (const std::string& header : headers) {
-            if (header[0] != '@') throw (header);
-            
-            int i = header.find(' ');
-            std::string key = trim(header.substr(1, i));
-            std::string value = trim(header.substr(i));
+        T value = 0;
+        std::from_chars_result result = std::from_chars(str.data(), str.data() + str.size(), value);
+        if (result.ec == std::errc::invalid_argument) throw std::invalid_argument("Invalid number: " + std::string(str));
+        if (result.ec == std::errc::result_out_of_range) throw std::out_of_range("Number out of range: " + std::string(str));
 
-            map[key] = value;
-        }
+        return value;
+    }
 
-        return map;
+    // Reads count comma separated numbers into out
+    template <typename T>
+    static void readNumbers(std::string_view str, T* out, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            size_t comma = i + 1 < count ? str.find(',') : str.size();
+            if (comma == std::string_view::npos) throw std::invalid_argument("Expected " + std::to_string(count) + " values: " + std::string(str));
+
+            out[i] = readNumber<T>(str.substr(0, comma));
+            str.remove_prefix(std::min(comma + 1, str.size()));
+        }
     }
 
-    static std::vector<Coordinate2D> read2DPoints(const std::string& input) {
-        std::vector<Coordinate2D> points;
+    static std::string_view unwrap(std::string_view str, char open, char close) {
+        str = trim(str);
+        if (str.size() < 2 || str.front() != open || str.back() != close)
+            throw std::invalid_argument("Expected " + std::string(1, open) + "..." + std::string(1, close) + ": " + std::string(str));
 
-        const std::vector<std::string> split = splitString(input, "*");
+        return str.substr(1, str.size() - 2);
+    }
 
-        for (std::string s0 : split) {
-            if (s0.empty()) continue;
+    static Coordinate2D readCoordinate2D(std::string_view str) {
+        double values[2];
+        readNumbers(unwrap(str, '[', ']'), values, 2);
+        return Coordinate2D(values[0], values[1]);
+    }
 
-            if (s0.rfind('(', 0) == 0 && s0.rfind(']') == s0.size() - 1) {
-                for (const Coordinate2D& c : LevelZ::CoordinateMatrix2D::from_string(s0))
-                    points.push_back(c);
-            } else
-                points.push_back(Coordinate2D::from_string(s0));
-        }
+    static Coordinate3D readCoordinate3D(std::string_view str) {
+        double values[3];
+        readNumbers(unwrap(str, '[', ']'), values, 3);
+        return Coordinate3D(values[0], values[1], values[2]);
+    }
+
+    static CoordinateMatrix2D readMatrix2D(std::string_view str) {
+        size_t caret = str.find('^');
+        if (caret == std::string_view::npos) throw std::invalid_argument("Expected '^' in matrix: " + std::string(str));
 
-        return points;
+        int bounds[4];
+        readNumbers(unwrap(str.substr(0, caret), '(', ')'), bounds, 4);
+        return CoordinateMatrix2D(bounds[0], bounds[1], bounds[2], bounds[3], readCoordinate2D(str.substr(caret + 1)));
     }
 
-    static std::vector<Coordinate3D> read3DPoints(const std::string& input) {
-        std::vector<Coordinate3D> points;
+    static CoordinateMatrix3D readMatrix3D(std::string_view str) {
+        size_t caret = str.find('^');
+        if (caret == std::string_view::npos) throw std::invalid_argument("Expected '^' in matrix: " + std::string(str));
 
-        const std::regex matrix("[\\[\\]()]");
-        const std::vector<std::string> split = splitString(input, "*");
+        int bounds[6];
+        readNumbers(unwrap(str.substr(0, caret), '(', ')'), bounds, 6);
+        return CoordinateMatrix3D(bounds[0], bounds[1], bounds[2], bounds[3], bounds[4], bounds[5], readCoordinate3D(str.substr(caret + 1)));
+    }
 
-        for (std::string s0 : split) {
-            if (s0.empty()) continue;
+    // Splits contents into views of its lines without copying them, dropping carriage returns
+    static void splitLines(std::string_view contents, LineList& lines) {
+        size_t start = 0;
+        while (true) {
+            size_t end = contents.find('\n', start);
+            std::string_view line = contents.substr(start, end == std::string_view::npos ? std::string_view::npos : end - start);
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
 
-            if (s0.rfind('(', 0) == 0 && s0.rfind(']') == s0.size() - 1) {
-                for (const Coordinate3D& c : LevelZ::CoordinateMatrix3D::from_string(s0))
-                    points.push_back(c);
-            } else
-                points.push_back(Coordinate3D::from_string(s0));
+            lines.push_back(line);
+            if (end == std::string_view::npos) break;
+            start = end + 1;
         }
-
-        return points;
     }
 
-    static Block readBlock(std::string& input) {
-        input.erase(std::remove(input.begin(), input.end(), ' '), input.end());
-        input.erase(std::remove(input.begin(), input.end(), '>'), input.end());
+    template <typename It>
+    static std::unordered_map<std::string, std::string> readHeaders(It begin, It end) {
+        std::unordered_map<std::string, std::string> map;
 
-        size_t pos = input.find('<');
-        if (pos == std::string::npos)
-            return Block(input);
+        for (; begin != end; ++begin) {
+            std::string_view header = *begin;
+            if (header.empty() || header[0] != '@') throw std::string(header);
 
-        std::string name = input.substr(0, pos);
-        std::string data = input.substr(pos + 1);
+            size_t i = header.find(' ');
+            std::string key(trim(header.substr(1, i == std::string_view::npos ? i : i - 1)));
+            std::string value(i == std::string_view::npos ? std::string_view() : trim(header.substr(i)));
 
-        std::unordered_map<std::string, std::string> properties;
-        size_t cpos = 0;
-        std::string s0, s1;
-        while ((cpos = data.find(',')) != std::string::npos) {
-            s0 = data.substr(0, cpos);
-            data.erase(0, cpos + 1);
-
-            if ((cpos = s0.find('=')) != std::string::npos) {
-                s1 = s0.substr(0, cpos);
-                s0.erase(0, cpos + 1);
-                properties[s1] = s0;
-            }
+            map[key] = value;
         }
 
-        return Block(name, properties);
+        return map;
     }
 
-    static std::pair<Block, std::vector<Coordinate2D>> read2DLine(std::string& line) {
-        line.erase(std::remove(line.begin(), line.end(), ' '), line.end());
+    static Block readBlock(std::string_view input) {
+        input = trim(input);
 
-        size_t pos = line.find(':');
-        std::string block = line.substr(0, pos);
-        std::string points = line.substr(pos + 1);
+        size_t pos = input.find('<');
+        if (pos == std::string_view::npos)
+            return Block(std::string(input));
 
-        return {readBlock(block), read2DPoints(points)};
-    }
+        std::string name(trim(input.substr(0, pos)));
+        std::string_view data = input.substr(pos + 1);
+        size_t close = data.rfind('>');
+        if (close != std::string_view::npos) data = data.substr(0, close);
 
-    static std::pair<Block, std::vector<Coordinate3D>> read3DLine(std::string& line) {
-        line.erase(std::remove(line.begin(), line.end(), ' '));
-        
-        size_t pos = line.find(':');
-        std::string block = line.substr(0, pos);
-        std::string points = line.substr(pos + 1);
+        std::unordered_map<std::string, std::string> properties;
+        while (!data.empty()) {
+            size_t cpos = data.find(',');
+            if (cpos == std::string_view::npos) cpos = data.size();
 
-        return {readBlock(block), read3DPoints(points)};
-    }
+            std::string_view entry = data.substr(0, cpos);
+            size_t epos = entry.find('=');
+            if (epos != std::string_view::npos)
+                properties[std::string(trim(entry.substr(0, epos)))] = std::string(trim(entry.substr(epos + 1)));
 
-}
+            data.remove_prefix(std::min(cpos + 1, data.size()));
+        }
 
-// Implementation
+        return Block(std::move(name), std::move(properties));
+    }
 
-namespace LevelZ {
+    template <typename Blocks, typename M>
+    static void readMatrix(const Block& block, const M& matrix, Blocks& blocks, ParseRecorder* recorder, std::chrono::steady_clock::time_point start) {
+        for (const auto& c : matrix)
+            blocks.push_back(LevelObject(block, c));
 
-    /**
-     * Reads a level from the specified lines.
-     * @param lines The contents to read the level from.
-     * @return The level read from the lines.
-     */
-    Level parseLines(const std::vector<std::string>& lines) {
-        std::vector<std::vector<std::string>> parts = split(lines);
-        std::unordered_map<std::string, std::string> headers = readHeaders(parts[0]);
+        if (recorder != nullptr) {
+            recorder->stats.matrices += std::chrono::duration_cast<std::chrono::nanoseconds>(ParseRecorder::now() - start);
+            recorder->stats.matrixCoordinates += matrix.size();
+        }
+    }
+
+    template <typename It>
+    static std::unordered_map<std::string, std::string> readLevelHeaders(It begin, It end) {
+        std::unordered_map<std::string, std::string> headers = readHeaders(begin, end);
 
         bool is2D = headers.at("type") == "2";
 
@@ -196,38 +333,64 @@ namespace LevelZ {
         if (is2D && headers.find("scroll") == headers.end())
             headers["scroll"] = "none";
 
-        std::vector<LevelObject> blocks;
-        for (std::string& line : parts[1]) {
-            if (line[0] == '#') continue;
-            if (line == END) break;
+        return headers;
+    }
+
+    // Appends the blocks on a body line, returning false once the end of the file is reached
+    template <typename Blocks>
+    static bool readBodyLine(std::string_view line, bool is2D, Blocks& blocks, ParseRecorder* recorder = nullptr, LevelZ::LevelStats* stats = nullptr) {
+        if (!line.empty() && line[0] == '#') return true;
+        if (line == END) return false;
 
-            int ci = line.find('#');
-            std::string line0 = ci == std::string::npos ? line : line.substr(0, ci);
-            line0.erase(line0.find_last_not_of(" \n\r\t") + 1);
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty()) return true;
 
-            if (is2D) {
-                std::pair<Block, std::vector<Coordinate2D>> pair = read2DLine(line0);
-                for (Coordinate2D& point : pair.second)
-                    blocks.push_back(LevelObject(pair.first, point));
+        size_t pos = line.find(':');
+        if (pos == std::string_view::npos) throw std::invalid_argument("Expected ':' in line: " + std::string(line));
+
+        const Block block = readBlock(line.substr(0, pos));
+        std::string_view points = line.substr(pos + 1);
+        const size_t counted = stats != nullptr ? stats->total : 0;
+
+        while (!points.empty()) {
+            size_t star = points.find('*');
+            if (star == std::string_view::npos) star = points.size();
+
+            std::string_view point = trim(points.substr(0, star));
+            points.remove_prefix(std::min(star + 1, points.size()));
+            if (point.empty()) continue;
+
+            if (point.front() == '(' && point.back() == ']') {
+                std::chrono::steady_clock::time_point start;
+                if (recorder != nullptr) start = ParseRecorder::now();
+
+                if (is2D) {
+                    const CoordinateMatrix2D matrix = readMatrix2D(point);
+                    readMatrix(block, matrix, blocks, recorder, start);
+                    if (stats != nullptr) stats->add(matrix);
+                } else {
+                    const CoordinateMatrix3D matrix = readMatrix3D(point);
+                    readMatrix(block, matrix, blocks, recorder, start);
+                    if (stats != nullptr) stats->add(matrix);
+                }
+            } else if (is2D) {
+                const Coordinate2D c = readCoordinate2D(point);
+                blocks.push_back(LevelObject(block, c));
+                if (stats != nullptr) stats->add(c);
             } else {
-                std::pair<Block, std::vector<Coordinate3D>> pair = read3DLine(line0);
-                for (Coordinate3D& point : pair.second)
-                    blocks.push_back(LevelObject(pair.first, point));
+                const Coordinate3D c = readCoordinate3D(point);
+                blocks.push_back(LevelObject(block, c));
+                if (stats != nullptr) stats->add(c);
             }
         }
 
-        if (is2D)
-            return Level2D(headers, blocks);
-        else
-            return Level3D(headers, blocks);
+        // one count per line rather than per block
+        if (stats != nullptr && stats->total > counted) stats->counts[block.name] += stats->total - counted;
+
+        return true;
     }
 
-        /**
-     * Reads a level from the specified string.
-     * @param string The contents to read the level from.
-     * @return The level read from the contents.
-     */
-    Level parseContents(const std::string& string) {
+    static std::vector<std::string> readContentLines(const std::string& string) {
         std::vector<std::string> lines;
         std::istringstream stream(string);
 
@@ -237,15 +400,10 @@ namespace LevelZ {
             lines.push_back(line);
         }
 
-        return parseLines(lines);
+        return lines;
     }
 
-    /**
-     * Parses a level from the specified file.
-     * @param file The file to read the level from.
-     * @return The level read from the file.
-     */
-    Level parseFile(const std::string& file) {
+    static std::vector<std::string> readFileLines(const std::string& file) {
         std::vector<std::string> lines;
         std::fstream stream(file);
 
@@ -254,7 +412,197 @@ namespace LevelZ {
             lines.push_back(line);
         }
 
-        return parseLines(lines);
+        return lines;
+    }
+
+    // Reads a whole file into a buffer, leaving it empty if the file cannot be read
+    static void readFileContents(const std::string& file, std::pmr::string& contents) {
+        std::ifstream stream(file, std::ios::binary | std::ios::ate);
+        if (!stream) return;
+
+        std::streamoff size = stream.tellg();
+        if (size < 0) {
+            stream.seekg(0);
+            contents.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+            return;
+        }
+
+        contents.resize(static_cast<size_t>(size));
+        stream.seekg(0);
+        stream.read(contents.data(), size);
+        contents.resize(static_cast<size_t>(stream.gcount()));
+    }
+
+    static Level createLevel(const std::unordered_map<std::string, std::string>& headers, LevelZ::BlockList&& blocks) {
+        return LevelZ::LevelBuilder::build(headers, std::move(blocks));
+    }
+
+    // Statistics no longer match the blocks once deduplication removed some, so the level computes them again when asked
+    static Level createLevel(const std::unordered_map<std::string, std::string>& headers, LevelZ::BlockList&& blocks, LevelZ::LevelStats&& stats, bool deduplicated) {
+        if (deduplicated) return createLevel(headers, std::move(blocks));
+        return LevelZ::LevelBuilder::build(headers, std::move(blocks), std::move(stats));
+    }
+
+    static std::pmr::memory_resource* resourceOf(const LevelZ::ParseOptions& options) {
+        return options.resource != nullptr ? options.resource : std::pmr::get_default_resource();
+    }
+
+    static Level parseLevel(const LineList& lines, const LevelZ::ParseOptions& options, ParseRecorder& recorder) {
+        const bool enabled = recorder.enabled();
+        std::chrono::steady_clock::time_point start;
+
+        if (enabled) {
+            recorder.stats.lines = lines.size();
+            start = ParseRecorder::now();
+        }
+
+        size_t index = 0;
+        for (size_t i = 0; i < lines.size(); i++)
+            if (lines[i] == LevelZ::HEADER_END) {
+                index = i;
+                break;
+            }
+
+        if (enabled) {
+            recorder.record(LevelZ::ParseStage::SPLIT, start);
+            start = ParseRecorder::now();
+        }
+
+        std::unordered_map<std::string, std::string> headers = readLevelHeaders(lines.begin(), lines.begin() + index);
+        bool is2D = headers.at("type") == "2";
+        if (enabled) {
+            recorder.record(LevelZ::ParseStage::HEADERS, start);
+            start = ParseRecorder::now();
+        }
+
+        LevelZ::BlockList blocks(resourceOf(options));
+        LevelZ::LevelStats stats;
+        for (size_t i = index + 1; i < lines.size(); i++)
+            if (!readBodyLine(lines[i], is2D, blocks, enabled ? &recorder : nullptr, &stats)) break;
+
+        if (enabled) recorder.stats.peakBlocks = blocks.size();
+
+        size_t removed = 0;
+        if (options.deduplicate)
+            removed = deduplicate(blocks);
+
+        if (options.spatialOrder)
+            sortMorton(blocks);
+
+        if (enabled) {
+            std::chrono::nanoseconds matrices = recorder.stats.matrices;
+            recorder.stats.matrices = std::chrono::nanoseconds(0);
+            recorder.record(LevelZ::ParseStage::BLOCKS, std::chrono::duration_cast<std::chrono::nanoseconds>(ParseRecorder::now() - start) - matrices);
+            recorder.record(LevelZ::ParseStage::MATRICES, matrices);
+            recorder.stats.objects = blocks.size();
+            start = ParseRecorder::now();
+        }
+
+        Level level = createLevel(headers, std::move(blocks), std::move(stats), removed > 0);
+        if (enabled) {
+            recorder.record(LevelZ::ParseStage::BUILD, start);
+            recorder.finish();
+        }
+
+        return level;
+    }
+
+} }
+
+// Implementation
+
+namespace LevelZ {
+
+    /**
+     * Reads a level from the specified lines.
+     * @param lines The contents to read the level from.
+     * @param options The options to parse the level with.
+     * @return The level read from the lines.
+     */
+    LEVELZ_API LEVELZ_INLINE Level parseLines(const std::vector<std::string>& lines, const ParseOptions& options = ParseOptions());
+
+    /**
+     * Reads a level from the specified string.
+     * @param string The contents to read the level from.
+     * @param options The options to parse the level with.
+     * @return The level read from the contents.
+     */
+    LEVELZ_API LEVELZ_INLINE Level parseContents(const std::string& string, const ParseOptions& options = ParseOptions());
+
+    /**
+     * Parses a level from the specified file.
+     * @param file The file to read the level from.
+     * @param options The options to parse the level with.
+     * @return The level read from the file.
+     */
+    LEVELZ_API LEVELZ_INLINE Level parseFile(const std::string& file, const ParseOptions& options = ParseOptions());
+
+#if !defined(LEVELZ_COMPILED) || defined(LEVELZ_IMPLEMENTATION)
+
+    LEVELZ_INLINE Level parseLines(const std::vector<std::string>& lines, const ParseOptions& options) {
+        ParseRecorder recorder(options);
+        if (recorder.enabled())
+            for (const std::string& line : lines)
+                recorder.stats.bytes += line.size() + 1;
+
+        LineList views(resourceOf(options));
+        views.reserve(lines.size());
+        for (const std::string& line : lines)
+            views.push_back(line);
+
+        return parseLevel(views, options, recorder);
+    }
+
+    LEVELZ_INLINE Level parseContents(const std::string& string, const ParseOptions& options) {
+        ParseRecorder recorder(options);
+        std::chrono::steady_clock::time_point start;
+        if (recorder.enabled()) start = ParseRecorder::now();
+
+        LineList lines(resourceOf(options));
+        splitLines(string, lines);
+
+        if (recorder.enabled()) {
+            recorder.record(ParseStage::READ, start);
+            recorder.stats.bytes = string.size();
+        }
+
+        return parseLevel(lines, options, recorder);
+    }
+
+    LEVELZ_INLINE Level parseFile(const std::string& file, const ParseOptions& options) {
+        ParseRecorder recorder(options);
+        std::chrono::steady_clock::time_point start;
+        if (recorder.enabled()) start = ParseRecorder::now();
+
+        std::pmr::string contents(resourceOf(options));
+        readFileContents(file, contents);
+
+        // like std::getline, a final line break does not start another line
+        std::string_view view = contents;
+        if (!view.empty() && view.back() == '\n') view.remove_suffix(1);
+
+        LineList lines(resourceOf(options));
+        if (!contents.empty()) splitLines(view, lines);
+
+        if (recorder.enabled()) {
+            recorder.record(ParseStage::READ, start);
+            recorder.stats.bytes = contents.size();
+        }
+
+        return parseLevel(lines, options, recorder);
     }
 
-}
\ No newline at end of file
+#endif
+
+}
+
+#include "levelz/incremental.hpp"
+#include "levelz/async.hpp"
+#include "levelz/binary.hpp"
+#include "levelz/cache.hpp"
+#include "levelz/registry.hpp"
+#include "levelz/static.hpp"
+
+#ifdef LEVELZ_ZLIB
+#include "levelz/compress.hpp"
+#endif
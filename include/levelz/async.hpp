@@ -0,0 +1,505 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <future>
+#include <thread>
+#include <utility>
+#include <fstream>
+#include <stdexcept>
+#include <functional>
+#include <filesystem>
+#include <string_view>
+
+#if __cplusplus >= 202002L && __has_include(<coroutine>)
+#include <coroutine>
+#include <optional>
+#include <exception>
+#include <mutex>
+#include <condition_variable>
+#define LEVELZ_COROUTINES 1
+#endif
+
+#include "../levelz.hpp"
+
+namespace LevelZ {
+
+    /**
+     * Parses a level from chunks of its contents as they arrive, such as blocks read from a file or network.
+     *
+     * Lines may be split across chunks; only the unfinished line at the end of a chunk is buffered.
+     * Timings are not collected into ParseOptions::stats, but the counters are.
+     */
+    struct LevelParser {
+        private:
+            ParseOptions _options;
+            std::string _partial;
+            std::vector<std::string> _headerLines;
+            std::unordered_map<std::string, std::string> _headers;
+            BlockList _blocks;
+            LevelStats _stats;
+            size_t _bytes = 0;
+            size_t _lines = 0;
+            bool _body = false;
+            bool _ended = false;
+            bool _is2D = true;
+
+            void readLine(std::string_view line) {
+                _lines++;
+                if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+                if (_ended) return;
+
+                if (!_body) {
+                    if (line == HEADER_END) {
+                        _headers = readLevelHeaders(_headerLines.begin(), _headerLines.end());
+                        _is2D = _headers.at("type") == "2";
+                        _headerLines.clear();
+                        _body = true;
+                    } else
+                        _headerLines.push_back(std::string(line));
+
+                    return;
+                }
+
+                if (!readBodyLine(line, _is2D, _blocks, nullptr, &_stats)) _ended = true;
+            }
+
+        public:
+            /**
+             * Constructs a new parser.
+             * @param options The options to parse the level with.
+             */
+            explicit LevelParser(const ParseOptions& options = ParseOptions()) : _options(options), _blocks(options.resource != nullptr ? options.resource : std::pmr::get_default_resource()) {}
+
+            /**
+             * Gets the number of bytes fed to the parser.
+             * @return The number of bytes.
+             */
+            inline size_t bytes() const {
+                return _bytes;
+            }
+
+            /**
+             * Gets the number of complete lines parsed.
+             * @return The number of lines.
+             */
+            inline size_t lines() const {
+                return _lines;
+            }
+
+            /**
+             * Gets the number of blocks parsed so far.
+             * @return The number of blocks.
+             */
+            inline size_t blocks() const {
+                return _blocks.size();
+            }
+
+            /**
+             * Gets whether the end marker has been reached. Anything fed afterwards is ignored.
+             * @return true if the end of the level was reached, false otherwise
+             */
+            inline bool ended() const {
+                return _ended;
+            }
+
+            /**
+             * Parses the complete lines in a chunk of the contents.
+             * @param chunk The next chunk of the contents.
+             * @throws std::invalid_argument if a line is malformed.
+             */
+            void feed(std::string_view chunk) {
+                _bytes += chunk.size();
+
+                size_t start = 0;
+                size_t end;
+                while ((end = chunk.find('\n', start)) != std::string_view::npos) {
+                    if (_partial.empty())
+                        readLine(chunk.substr(start, end - start));
+                    else {
+                        _partial.append(chunk.data() + start, end - start);
+                        readLine(_partial);
+                        _partial.clear();
+                    }
+
+                    start = end + 1;
+                }
+
+                _partial.append(chunk.data() + start, chunk.size() - start);
+            }
+
+            /**
+             * Parses the last line and builds the level. The parser cannot be used afterwards.
+             * @return The parsed level.
+             * @throws std::out_of_range if the level has no header section.
+             */
+            Level finish() {
+                if (!_partial.empty()) {
+                    std::string line = std::move(_partial);
+                    _partial.clear();
+                    readLine(line);
+                }
+
+                if (!_body)
+                    throw std::out_of_range("Level is missing the end of its header section");
+
+                size_t removed = 0;
+                if (_options.deduplicate)
+                    removed = deduplicate(_blocks);
+
+                if (_options.spatialOrder)
+                    sortMorton(_blocks);
+
+                ParseRecorder recorder(_options);
+                if (recorder.enabled()) {
+                    recorder.stats.bytes = _bytes;
+                    recorder.stats.lines = _lines;
+                    recorder.stats.objects = _blocks.size();
+                    recorder.stats.peakBlocks = _blocks.size();
+                    recorder.finish();
+                }
+
+                return createLevel(_headers, std::move(_blocks), std::move(_stats), removed > 0);
+            }
+    };
+
+    /**
+     * Thrown when a load is cancelled through its CancellationToken.
+     */
+    struct LoadCancelled : std::runtime_error {
+        public:
+            LoadCancelled() : std::runtime_error("Level loading was cancelled") {}
+    };
+
+    /**
+     * A shared flag for cancelling a load from another thread. Copies refer to the same flag.
+     */
+    struct CancellationToken {
+        private:
+            std::shared_ptr<std::atomic<bool>> _cancelled = std::make_shared<std::atomic<bool>>(false);
+
+        public:
+            /**
+             * Requests cancellation. The load stops before parsing its next chunk.
+             */
+            void cancel() {
+                _cancelled->store(true, std::memory_order_relaxed);
+            }
+
+            /**
+             * Gets whether cancellation was requested.
+             * @return true if cancelled, false otherwise
+             */
+            bool cancelled() const {
+                return _cancelled->load(std::memory_order_relaxed);
+            }
+    };
+
+    /**
+     * The progress of a load, reported after each chunk.
+     */
+    struct LoadProgress {
+        public:
+            /**
+             * The number of bytes read and parsed.
+             */
+            size_t bytes = 0;
+
+            /**
+             * The size of the file, or 0 if unknown.
+             */
+            size_t total = 0;
+
+            /**
+             * The number of blocks parsed so far.
+             */
+            size_t blocks = 0;
+
+            /**
+             * Gets the fraction of the file that has been parsed.
+             * @return The fraction from 0 to 1, or 0 if the size is unknown.
+             */
+            double fraction() const {
+                return total == 0 ? 0.0 : static_cast<double>(bytes) / static_cast<double>(total);
+            }
+    };
+
+    /**
+     * Options for loading a level file.
+     */
+    struct LoadOptions {
+        /**
+         * The options to parse the level with.
+         */
+        ParseOptions parse;
+
+        /**
+         * The number of bytes to read at a time. The next chunk is read while the current one is parsed.
+         */
+        size_t chunkSize = 256 * 1024;
+
+        /**
+         * Called on the loading thread after each chunk is parsed, or empty for no progress reports.
+         */
+        std::function<void(const LoadProgress&)> progress;
+
+        /**
+         * The token to cancel the load with.
+         */
+        CancellationToken token;
+    };
+
+    /**
+     * Loads a level from a file in chunks, reading the next chunk while parsing the current one.
+     * @param file The file to read the level from.
+     * @param options The options to load the level with.
+     * @return The level read from the file.
+     * @throws std::invalid_argument if the file cannot be opened, or a line is malformed.
+     * @throws LoadCancelled if the load is cancelled.
+     */
+    inline Level loadFile(const std::string& file, const LoadOptions& options = LoadOptions()) {
+        std::ifstream stream(file, std::ios::binary);
+        if (!stream) throw std::invalid_argument("Could not open level file: " + file);
+
+        std::error_code error;
+        LoadProgress progress;
+        std::uintmax_t size = std::filesystem::file_size(file, error);
+        if (!error) progress.total = static_cast<size_t>(size);
+
+        const size_t chunkSize = std::max<size_t>(options.chunkSize, 1);
+        auto read = [&stream, chunkSize](std::string& buffer) {
+            buffer.resize(chunkSize);
+            stream.read(buffer.data(), static_cast<std::streamsize>(chunkSize));
+            buffer.resize(static_cast<size_t>(stream.gcount()));
+        };
+
+        LevelParser parser(options.parse);
+        std::string current;
+        std::string next;
+        read(current);
+
+        while (!current.empty()) {
+            if (options.token.cancelled()) throw LoadCancelled();
+
+            std::future<void> pending;
+            if (current.size() == chunkSize)
+                pending = std::async(std::launch::async, read, std::ref(next));
+            else
+                next.clear();
+
+            try {
+                parser.feed(current);
+            } catch (...) {
+                if (pending.valid()) pending.wait();
+                throw;
+            }
+
+            if (pending.valid()) pending.get();
+
+            progress.bytes = parser.bytes();
+            progress.blocks = parser.blocks();
+            if (options.progress) options.progress(progress);
+
+            std::swap(current, next);
+            if (parser.ended()) break;
+        }
+
+        if (options.token.cancelled()) throw LoadCancelled();
+        return parser.finish();
+    }
+
+    /**
+     * Loads a level from a file on a background thread.
+     * @param file The file to read the level from.
+     * @param options The options to load the level with.
+     * @return A future that holds the level, or the exception that stopped the load.
+     */
+    inline std::future<Level> loadFileAsync(const std::string& file, const LoadOptions& options = LoadOptions()) {
+        return std::async(std::launch::async, [file, options]() {
+            return loadFile(file, options);
+        });
+    }
+
+    /**
+     * Parses a level from a string on a background thread.
+     * @param string The contents to read the level from.
+     * @param options The options to parse the level with.
+     * @return A future that holds the level, or the exception that stopped the parse.
+     */
+    inline std::future<Level> parseContentsAsync(std::string string, const ParseOptions& options = ParseOptions()) {
+        return std::async(std::launch::async, [string = std::move(string), options]() {
+            return parseContents(string, options);
+        });
+    }
+
+#ifdef LEVELZ_COROUTINES
+
+    /**
+     * A lazily started coroutine producing a value. Requires C++20.
+     *
+     * The coroutine starts when the task is awaited with co_await, or when get() is called.
+     * @tparam T The type of the value.
+     */
+    template <typename T>
+    struct Task {
+        public:
+            struct promise_type {
+                std::optional<T> value;
+                std::exception_ptr error;
+                std::coroutine_handle<> continuation;
+                std::mutex mutex;
+                std::condition_variable condition;
+                bool done = false;
+
+                struct FinalAwaiter {
+                    bool await_ready() noexcept {
+                        return false;
+                    }
+
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+                        promise_type& promise = handle.promise();
+                        if (promise.continuation) return promise.continuation;
+
+                        std::lock_guard<std::mutex> lock(promise.mutex);
+                        promise.done = true;
+                        promise.condition.notify_all();
+                        return std::noop_coroutine();
+                    }
+
+                    void await_resume() noexcept {}
+                };
+
+                Task get_return_object() {
+                    return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+                }
+
+                std::suspend_always initial_suspend() noexcept {
+                    return {};
+                }
+
+                FinalAwaiter final_suspend() noexcept {
+                    return {};
+                }
+
+                void return_value(T result) {
+                    value.emplace(std::move(result));
+                }
+
+                void unhandled_exception() {
+                    error = std::current_exception();
+                }
+            };
+
+        private:
+            std::coroutine_handle<promise_type> _handle;
+
+            T result() {
+                promise_type& promise = _handle.promise();
+                if (promise.error) std::rethrow_exception(promise.error);
+                return std::move(*promise.value);
+            }
+
+        public:
+            explicit Task(std::coroutine_handle<promise_type> handle) : _handle(handle) {}
+
+            Task(Task&& other) noexcept : _handle(std::exchange(other._handle, {})) {}
+
+            Task(const Task&) = delete;
+            Task& operator=(const Task&) = delete;
+
+            ~Task() {
+                if (_handle) _handle.destroy();
+            }
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                _handle.promise().continuation = awaiting;
+                return _handle;
+            }
+
+            T await_resume() {
+                return result();
+            }
+
+            /**
+             * Runs the task and blocks the calling thread until it completes.
+             * @return The value produced by the task.
+             */
+            T get() {
+                _handle.resume();
+
+                promise_type& promise = _handle.promise();
+                std::unique_lock<std::mutex> lock(promise.mutex);
+                promise.condition.wait(lock, [&promise]() { return promise.done; });
+                lock.unlock();
+
+                return result();
+            }
+    };
+
+    /**
+     * Suspends the awaiting coroutine while a level file loads on a background thread, resuming it on that thread.
+     */
+    struct LoadAwaiter {
+        private:
+            std::optional<Level> _level;
+            std::exception_ptr _error;
+
+        public:
+            /**
+             * The file to read the level from.
+             */
+            std::string file;
+
+            /**
+             * The options to load the level with.
+             */
+            LoadOptions options;
+
+            /**
+             * Constructs a new awaiter for the specified file.
+             * @param file The file to read the level from.
+             * @param options The options to load the level with.
+             */
+            LoadAwaiter(std::string file, LoadOptions options) : file(std::move(file)), options(std::move(options)) {}
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle) {
+                std::thread([this, handle]() {
+                    try {
+                        _level.emplace(loadFile(file, options));
+                    } catch (...) {
+                        _error = std::current_exception();
+                    }
+
+                    handle.resume();
+                }).detach();
+            }
+
+            Level await_resume() {
+                if (_error) std::rethrow_exception(_error);
+                return std::move(*_level);
+            }
+    };
+
+    /**
+     * Loads a level from a file on a background thread, as a coroutine. Requires C++20.
+     * @param file The file to read the level from.
+     * @param options The options to load the level with.
+     * @return A task producing the level. The calling coroutine resumes on the loading thread.
+     */
+    inline Task<Level> loadFileTask(std::string file, LoadOptions options = LoadOptions()) {
+        co_return co_await LoadAwaiter(std::move(file), std::move(options));
+    }
+
+#endif
+
+}
@@ -0,0 +1,305 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <memory_resource>
+
+#include "../levelz.hpp"
+
+namespace LevelZ {
+
+    /**
+     * Computes the XXH64 hash of a sequence of bytes.
+     * @param data The bytes to hash.
+     * @param size The number of bytes.
+     * @param seed The seed of the hash.
+     * @return The 64-bit hash, identical to the reference XXH64 implementation.
+     */
+    inline uint64_t xxhash64(const void* data, size_t size, uint64_t seed = 0) {
+        constexpr uint64_t P1 = 11400714785074694791ULL;
+        constexpr uint64_t P2 = 14029467366897019727ULL;
+        constexpr uint64_t P3 = 1609587929392839161ULL;
+        constexpr uint64_t P4 = 9650029242287828579ULL;
+        constexpr uint64_t P5 = 2870177450012600261ULL;
+
+        auto rotl = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+        auto read64 = [](const unsigned char* p) {
+            uint64_t v = 0;
+            for (int i = 7; i >= 0; i--) v = (v << 8) | p[i];
+            return v;
+        };
+        auto read32 = [](const unsigned char* p) {
+            return static_cast<uint64_t>(p[0]) | static_cast<uint64_t>(p[1]) << 8 | static_cast<uint64_t>(p[2]) << 16 | static_cast<uint64_t>(p[3]) << 24;
+        };
+        auto round = [&rotl](uint64_t acc, uint64_t input) {
+            acc += input * P2;
+            acc = rotl(acc, 31);
+            return acc * P1;
+        };
+        auto merge = [&round](uint64_t acc, uint64_t value) {
+            acc ^= round(0, value);
+            return acc * P1 + P4;
+        };
+
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        const unsigned char* end = p + size;
+        uint64_t h;
+
+        if (size >= 32) {
+            uint64_t v1 = seed + P1 + P2;
+            uint64_t v2 = seed + P2;
+            uint64_t v3 = seed;
+            uint64_t v4 = seed - P1;
+
+            for (; p + 32 <= end; p += 32) {
+                v1 = round(v1, read64(p));
+                v2 = round(v2, read64(p + 8));
+                v3 = round(v3, read64(p + 16));
+                v4 = round(v4, read64(p + 24));
+            }
+
+            h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+            h = merge(h, v1);
+            h = merge(h, v2);
+            h = merge(h, v3);
+            h = merge(h, v4);
+        } else
+            h = seed + P5;
+
+        h += static_cast<uint64_t>(size);
+
+        for (; p + 8 <= end; p += 8) {
+            h ^= round(0, read64(p));
+            h = rotl(h, 27) * P1 + P4;
+        }
+
+        if (p + 4 <= end) {
+            h ^= read32(p) * P1;
+            h = rotl(h, 23) * P2 + P3;
+            p += 4;
+        }
+
+        for (; p < end; p++) {
+            h ^= static_cast<uint64_t>(*p) * P5;
+            h = rotl(h, 11) * P1;
+        }
+
+        h ^= h >> 33;
+        h *= P2;
+        h ^= h >> 29;
+        h *= P3;
+        h ^= h >> 32;
+        return h;
+    }
+
+    /**
+     * The version of the binary level format written by serializeLevel.
+     */
+    const uint16_t BINARY_VERSION = 2;
+
+    /**
+     * Writes a level in the compact binary format.
+     *
+     * Each distinct block is stored once and referenced by index. Consecutive objects of the same block are stored as one run,
+     * so levels sorted with sortMorton are smaller. Coordinates are stored as raw doubles in the byte order of the host.
+     * Readers on a host with a different byte order reject the data.
+     * @param level The level to write.
+     * @param out The stream to write to.
+     */
+    inline void serializeLevel(const Level& level, std::ostream& out) {
+        auto put = [&out](const auto& value) {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        };
+        auto putString = [&out, &put](const std::string& value) {
+            put(static_cast<uint32_t>(value.size()));
+            out.write(value.data(), static_cast<std::streamsize>(value.size()));
+        };
+
+        out.write("LVZB", 4);
+        put(BINARY_VERSION);
+        put(static_cast<uint16_t>(0x0102));
+
+        put(static_cast<uint32_t>(level.headers().size()));
+        for (auto const& [k, v] : level.headers()) {
+            putString(k);
+            putString(v);
+        }
+
+        std::unordered_map<Block, uint32_t> index;
+        std::vector<const Block*> blocks;
+        std::vector<uint32_t> references;
+        references.reserve(level.blocks().size());
+
+        for (const LevelObject& o : level.blocks()) {
+            auto it = index.find(o.block());
+            if (it == index.end()) {
+                it = index.emplace(o.block(), static_cast<uint32_t>(blocks.size())).first;
+                blocks.push_back(&o.block());
+            }
+
+            references.push_back(it->second);
+        }
+
+        put(static_cast<uint32_t>(blocks.size()));
+        for (const Block* block : blocks) {
+            putString(block->name);
+            put(static_cast<uint32_t>(block->properties.size()));
+            for (auto const& [k, v] : block->properties) {
+                putString(k);
+                putString(v);
+            }
+        }
+
+        const std::vector<BlockRun> runs = blockRuns(level.blocks());
+        put(static_cast<uint64_t>(level.blocks().size()));
+        put(static_cast<uint64_t>(runs.size()));
+        for (const BlockRun& run : runs) {
+            const bool is2D = level.blocks()[run.offset].is2D();
+            put(references[run.offset]);
+            put(static_cast<uint8_t>(is2D ? 2 : 3));
+            put(static_cast<uint64_t>(run.length));
+
+            for (size_t i = run.offset; i < run.offset + run.length; i++) {
+                const Coordinate3D& c = level.blocks()[i].coordinate3D();
+                put(c.x);
+                put(c.y);
+                if (!is2D) put(c.z);
+            }
+        }
+    }
+
+    /**
+     * Writes a level in the compact binary format.
+     * @param level The level to write.
+     * @return The binary form of the level.
+     */
+    inline std::string serializeLevel(const Level& level) {
+        std::ostringstream out;
+        serializeLevel(level, out);
+        return out.str();
+    }
+
+    /**
+     * Reads a level written by serializeLevel.
+     * @param data The binary form of the level.
+     * @param size The number of bytes.
+     * @param resource The memory resource to allocate the blocks from, or nullptr for the default resource.
+     * @return The level.
+     * @throws std::invalid_argument if the data is truncated, malformed, or written with another version or byte order.
+     */
+    inline Level deserializeLevel(const char* data, size_t size, std::pmr::memory_resource* resource = nullptr) {
+        size_t pos = 0;
+
+        auto need = [&](size_t n) {
+            if (n > size - pos) throw std::invalid_argument("Truncated binary level");
+        };
+        auto get = [&](auto& value) {
+            need(sizeof(value));
+            std::memcpy(&value, data + pos, sizeof(value));
+            pos += sizeof(value);
+        };
+        auto getString = [&]() {
+            uint32_t length;
+            get(length);
+            need(length);
+            std::string value(data + pos, length);
+            pos += length;
+            return value;
+        };
+
+        need(4);
+        if (std::memcmp(data, "LVZB", 4) != 0) throw std::invalid_argument("Not a binary level");
+        pos += 4;
+
+        uint16_t version, order;
+        get(version);
+        get(order);
+        if (version != BINARY_VERSION) throw std::invalid_argument("Unsupported binary level version " + std::to_string(version));
+        if (order != 0x0102) throw std::invalid_argument("Binary level was written with a different byte order");
+
+        uint32_t headerCount;
+        get(headerCount);
+
+        std::unordered_map<std::string, std::string> headers;
+        for (uint32_t i = 0; i < headerCount; i++) {
+            std::string key = getString();
+            headers[key] = getString();
+        }
+
+        uint32_t blockCount;
+        get(blockCount);
+
+        std::vector<Block> blocks;
+        blocks.reserve(std::min<size_t>(blockCount, size));
+        for (uint32_t i = 0; i < blockCount; i++) {
+            std::string name = getString();
+
+            uint32_t propertyCount;
+            get(propertyCount);
+
+            std::unordered_map<std::string, std::string> properties;
+            for (uint32_t j = 0; j < propertyCount; j++) {
+                std::string key = getString();
+                properties[key] = getString();
+            }
+
+            blocks.push_back(Block(std::move(name), std::move(properties)));
+        }
+
+        uint64_t objectCount, runCount;
+        get(objectCount);
+        get(runCount);
+        if (objectCount > (size - pos) / (2 * sizeof(double))) throw std::invalid_argument("Truncated binary level");
+
+        BlockList objects(resource != nullptr ? resource : std::pmr::get_default_resource());
+        objects.reserve(static_cast<size_t>(objectCount));
+        for (uint64_t i = 0; i < runCount; i++) {
+            uint32_t reference;
+            uint8_t dimensions;
+            uint64_t length;
+            get(reference);
+            get(dimensions);
+            get(length);
+
+            if (reference >= blocks.size()) throw std::invalid_argument("Invalid block reference in binary level");
+            if (dimensions != 2 && dimensions != 3) throw std::invalid_argument("Invalid coordinate in binary level");
+            if (length > objectCount - objects.size()) throw std::invalid_argument("Invalid block run in binary level");
+
+            for (uint64_t j = 0; j < length; j++) {
+                double x, y;
+                get(x);
+                get(y);
+
+                if (dimensions == 2)
+                    objects.push_back(LevelObject(blocks[reference], Coordinate2D(x, y)));
+                else {
+                    double z;
+                    get(z);
+                    objects.push_back(LevelObject(blocks[reference], Coordinate3D(x, y, z)));
+                }
+            }
+        }
+
+        if (objects.size() != objectCount) throw std::invalid_argument("Truncated binary level");
+
+        return LevelBuilder::build(headers, std::move(objects));
+    }
+
+    /**
+     * Reads a level written by serializeLevel.
+     * @param data The binary form of the level.
+     * @param resource The memory resource to allocate the blocks from, or nullptr for the default resource.
+     * @return The level.
+     * @throws std::invalid_argument if the data is truncated, malformed, or written with another version or byte order.
+     */
+    inline Level deserializeLevel(std::string_view data, std::pmr::memory_resource* resource = nullptr) {
+        return deserializeLevel(data.data(), data.size(), resource);
+    }
+
+}
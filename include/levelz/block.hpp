@@ -1,10 +1,230 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <memory>
+#include <charconv>
+#include <cstdlib>
+#include <stdexcept>
 #include <unordered_map>
 
+#include "coordinate.hpp"
+
 namespace LevelZ {
 
+    /**
+     * Represents the type of a block property value.
+     */
+    enum class PropertyType {
+        /**
+         * Raw string value
+         */
+        STRING,
+
+        /**
+         * Integer value
+         */
+        INT,
+
+        /**
+         * Boolean value, either "true" or "false"
+         */
+        BOOL,
+
+        /**
+         * Floating point value
+         */
+        DOUBLE,
+
+        /**
+         * One of a fixed set of string values
+         */
+        ENUM
+    };
+
+    /**
+     * Describes the property types of a block with a given name.
+     * 
+     * Registered schemas are used while parsing to pre-type property values and reject invalid ones.
+     * Schemas should be registered before any level is parsed, as the registry is not synchronized.
+     */
+    struct BlockSchema {
+        public:
+            /**
+             * The types of the properties, by key.
+             */
+            std::unordered_map<std::string, PropertyType> types;
+
+            /**
+             * The allowed values of enum properties, by key.
+             */
+            std::unordered_map<std::string, std::vector<std::string>> enums;
+
+            /**
+             * Declares the type of a property.
+             * @param key The key of the property.
+             * @param type The type of the property.
+             * @return This schema.
+             */
+            BlockSchema& property(const std::string& key, PropertyType type) {
+                types[key] = type;
+                return *this;
+            }
+
+            /**
+             * Declares an enum property with the specified allowed values.
+             * @param key The key of the property.
+             * @param values The allowed values, in ordinal order.
+             * @return This schema.
+             */
+            BlockSchema& enumeration(const std::string& key, const std::vector<std::string>& values) {
+                types[key] = PropertyType::ENUM;
+                enums[key] = values;
+                return *this;
+            }
+
+            /**
+             * Registers a schema for the blocks with the specified name, replacing any existing schema.
+             * @param block The name of the block.
+             * @param schema The schema of the block.
+             */
+            static void registerSchema(const std::string& block, const BlockSchema& schema) {
+                registry()[block] = schema;
+            }
+
+            /**
+             * Removes the schema for the blocks with the specified name.
+             * @param block The name of the block.
+             */
+            static void unregisterSchema(const std::string& block) {
+                registry().erase(block);
+            }
+
+            /**
+             * Finds the schema registered for the blocks with the specified name.
+             * @param block The name of the block.
+             * @return The schema, or nullptr if none is registered.
+             */
+            static const BlockSchema* find(const std::string& block) {
+                const std::unordered_map<std::string, BlockSchema>& map = registry();
+                if (map.empty()) return nullptr;
+
+                auto it = map.find(block);
+                return it == map.end() ? nullptr : &it->second;
+            }
+
+        private:
+            static std::unordered_map<std::string, BlockSchema>& registry() {
+                static std::unordered_map<std::string, BlockSchema> map;
+                return map;
+            }
+    };
+
+    /**
+     * Represents the typed interpretations of a block property value, parsed once when the block is created.
+     */
+    struct PropertyValue {
+        public:
+            /**
+             * The type of the property, as declared by its schema or STRING if undeclared.
+             */
+            PropertyType type = PropertyType::STRING;
+
+            /**
+             * Whether the value is a valid integer.
+             */
+            bool isInt = false;
+
+            /**
+             * Whether the value is a valid boolean.
+             */
+            bool isBool = false;
+
+            /**
+             * Whether the value is a valid floating point number.
+             */
+            bool isDouble = false;
+
+            /**
+             * The integer value, if isInt is true.
+             */
+            int intValue = 0;
+
+            /**
+             * The boolean value, if isBool is true.
+             */
+            bool boolValue = false;
+
+            /**
+             * The floating point value, if isDouble is true.
+             */
+            double doubleValue = 0;
+
+            /**
+             * The ordinal of the value in its schema's enum values, or -1 if it is not an enum value.
+             */
+            int enumIndex = -1;
+
+            /**
+             * Parses the typed interpretations of a raw property value.
+             * @param key The key of the property.
+             * @param value The raw value of the property.
+             * @param schema The schema of the block, or nullptr if there is none.
+             * @return The parsed property value.
+             * @throws std::invalid_argument if the value does not match the type declared by the schema.
+             */
+            static PropertyValue parse(const std::string& key, const std::string& value, const BlockSchema* schema) {
+                PropertyValue v;
+                const char* begin = value.data();
+                const char* end = begin + value.size();
+
+                std::from_chars_result ri = std::from_chars(begin, end, v.intValue);
+                v.isInt = !value.empty() && ri.ec == std::errc() && ri.ptr == end;
+
+                if (v.isInt) {
+                    v.isDouble = true;
+                    v.doubleValue = v.intValue;
+                } else if (!value.empty()) {
+                    char* dend = nullptr;
+                    v.doubleValue = std::strtod(begin, &dend);
+                    v.isDouble = dend == end;
+                }
+
+                v.isBool = value == "true" || value == "false";
+                v.boolValue = value == "true";
+
+                if (schema == nullptr) return v;
+
+                auto type = schema->types.find(key);
+                if (type == schema->types.end()) return v;
+                v.type = type->second;
+
+                bool valid = true;
+                switch (v.type) {
+                    case PropertyType::STRING: break;
+                    case PropertyType::INT: valid = v.isInt; break;
+                    case PropertyType::BOOL: valid = v.isBool; break;
+                    case PropertyType::DOUBLE: valid = v.isDouble; break;
+                    case PropertyType::ENUM: {
+                        auto values = schema->enums.find(key);
+                        if (values != schema->enums.end())
+                            for (size_t i = 0; i < values->second.size(); i++)
+                                if (values->second[i] == value) {
+                                    v.enumIndex = static_cast<int>(i);
+                                    break;
+                                }
+
+                        valid = v.enumIndex != -1;
+                        break;
+                    }
+                }
+
+                if (!valid) throw std::invalid_argument("Invalid value for property '" + key + "': " + value);
+
+                return v;
+            }
+    };
+
     /**
      * Represents a block in a game level.
      */
@@ -17,20 +237,26 @@ namespace LevelZ {
 
             /**
              * The properties of the block.
+             * 
+             * Typed accessors read from a cache built when the block is created, so properties
+             * should be changed through setProperty to keep them in sync.
              */
             std::unordered_map<std::string, std::string> properties;
 
             /**
              * Constructs a new block with the specified name and empty properties.
              */
-            explicit Block(std::string name) : name(name) {}
+            explicit Block(std::string name) : name(std::move(name)) {}
 
             /**
              * Constructs a new block with the specified name and properties.
              * @param name The name of the block.
              * @param properties The properties of the block.
+             * @throws std::invalid_argument if a property does not match the schema registered for the block.
              */
-            Block(std::string name, std::unordered_map<std::string, std::string> properties) : name(name), properties(properties) {}
+            Block(std::string name, std::unordered_map<std::string, std::string> properties) : name(std::move(name)), properties(std::move(properties)) {
+                index();
+            }
 
             /**
              * Gets the property of the block with the specified key.
@@ -60,6 +286,115 @@ namespace LevelZ {
                 return properties.find(key) != properties.end();
             }
 
+            /**
+             * Sets the value of a property, updating its typed value.
+             * @param key The key of the property.
+             * @param value The value of the property.
+             * @throws std::invalid_argument if the value does not match the schema registered for the block.
+             */
+            void setProperty(const std::string& key, const std::string& value) {
+                properties[key] = value;
+                index();
+            }
+
+            /**
+             * Gets the typed value of the property with the specified key.
+             * @param key The key of the property.
+             * @return The typed value of the property.
+             * @throws std::out_of_range if the property does not exist.
+             */
+            const PropertyValue& getValue(const std::string& key) const {
+                if (!_values) throw std::out_of_range("Property not found: " + key);
+                return _values->at(key);
+            }
+
+            /**
+             * Gets the property with the specified key as an integer.
+             * @param key The key of the property.
+             * @return The integer value of the property.
+             * @throws std::out_of_range if the property does not exist.
+             * @throws std::invalid_argument if the property is not an integer.
+             */
+            int getInt(const std::string& key) const {
+                const PropertyValue& v = getValue(key);
+                if (!v.isInt) throw std::invalid_argument("Property '" + key + "' is not an integer");
+                return v.intValue;
+            }
+
+            /**
+             * Gets the property with the specified key as an integer, or a default value if it does not exist or is not an integer.
+             * @param key The key of the property.
+             * @param defaultValue The default value.
+             * @return The integer value of the property, or the default value.
+             */
+            int getInt(const std::string& key, int defaultValue) const {
+                const PropertyValue* v = findValue(key);
+                return v != nullptr && v->isInt ? v->intValue : defaultValue;
+            }
+
+            /**
+             * Gets the property with the specified key as a boolean.
+             * @param key The key of the property.
+             * @return The boolean value of the property.
+             * @throws std::out_of_range if the property does not exist.
+             * @throws std::invalid_argument if the property is not "true" or "false".
+             */
+            bool getBool(const std::string& key) const {
+                const PropertyValue& v = getValue(key);
+                if (!v.isBool) throw std::invalid_argument("Property '" + key + "' is not a boolean");
+                return v.boolValue;
+            }
+
+            /**
+             * Gets the property with the specified key as a boolean, or a default value if it does not exist or is not a boolean.
+             * @param key The key of the property.
+             * @param defaultValue The default value.
+             * @return The boolean value of the property, or the default value.
+             */
+            bool getBool(const std::string& key, bool defaultValue) const {
+                const PropertyValue* v = findValue(key);
+                return v != nullptr && v->isBool ? v->boolValue : defaultValue;
+            }
+
+            /**
+             * Gets the property with the specified key as a floating point number.
+             * @param key The key of the property.
+             * @return The floating point value of the property.
+             * @throws std::out_of_range if the property does not exist.
+             * @throws std::invalid_argument if the property is not a number.
+             */
+            double getDouble(const std::string& key) const {
+                const PropertyValue& v = getValue(key);
+                if (!v.isDouble) throw std::invalid_argument("Property '" + key + "' is not a number");
+                return v.doubleValue;
+            }
+
+            /**
+             * Gets the property with the specified key as a floating point number, or a default value if it does not exist or is not a number.
+             * @param key The key of the property.
+             * @param defaultValue The default value.
+             * @return The floating point value of the property, or the default value.
+             */
+            double getDouble(const std::string& key, double defaultValue) const {
+                const PropertyValue* v = findValue(key);
+                return v != nullptr && v->isDouble ? v->doubleValue : defaultValue;
+            }
+
+            /**
+             * Gets the property with the specified key as an enum, using the ordinal of its value in the registered BlockSchema.
+             * @tparam E The enum type, whose values match the order of the schema's values.
+             * @param key The key of the property.
+             * @return The enum value of the property.
+             * @throws std::out_of_range if the property does not exist.
+             * @throws std::invalid_argument if the property is not declared as an enum by the block's schema.
+             */
+            template <typename E = int>
+            E getEnum(const std::string& key) const {
+                const PropertyValue& v = getValue(key);
+                if (v.enumIndex == -1) throw std::invalid_argument("Property '" + key + "' is not an enum");
+                return static_cast<E>(v.enumIndex);
+            }
+
             /**
              * Compares two blocks for equality.
              * @param other The other block to compare to.
@@ -88,8 +423,11 @@ namespace LevelZ {
 
                 str += name + "<";
 
+                bool first = true;
                 for (auto const& [k, v] : properties) {
+                    if (!first) str += ",";
                     str += k + "=" + v;
+                    first = false;
                 }
 
                 str += ">";
@@ -105,53 +443,106 @@ namespace LevelZ {
             std::ostream& operator<<(std::ostream &strm) {
                 return strm << to_string();
             }
+
+        private:
+            std::shared_ptr<const std::unordered_map<std::string, PropertyValue>> _values;
+
+            void index() {
+                if (properties.empty()) {
+                    _values.reset();
+                    return;
+                }
+
+                const BlockSchema* schema = BlockSchema::find(name);
+                std::shared_ptr<std::unordered_map<std::string, PropertyValue>> values = std::make_shared<std::unordered_map<std::string, PropertyValue>>();
+                values->reserve(properties.size());
+
+                for (auto const& [k, v] : properties)
+                    (*values)[k] = PropertyValue::parse(k, v, schema);
+
+                _values = values;
+            }
+
+            const PropertyValue* findValue(const std::string& key) const {
+                if (!_values) return nullptr;
+
+                auto it = _values->find(key);
+                return it == _values->end() ? nullptr : &it->second;
+            }
     };
 
     /**
      * Utility Object for representing a Level Block and its Coordinate.
+     * 
+     * The coordinate is stored inline; 2D objects use the X and Y components of a 3D coordinate with Z at 0.
      */
     struct LevelObject {
         private:
-            Coordinate* _coordinate;
             Block _block;
+            Coordinate3D _coordinate;
+            bool _is2D;
         public:
             /**
              * Constructs a new LevelObject with the specified block and coordinate.
              * @param block The block of the object.
              * @param coordinate The coordinate of the object.
              */
-            LevelObject(Block block, Coordinate2D coordinate) : _block(block), _coordinate(new Coordinate2D(coordinate)) {}
+            LevelObject(Block block, Coordinate2D coordinate) : _block(std::move(block)), _coordinate(coordinate.x, coordinate.y, 0.0), _is2D(true) {}
 
             /**
              * Constructs a new LevelObject with the specified block and coordinate.
              * @param block The block of the object.
              * @param coordinate The coordinate of the object.
              */
-            LevelObject(Block block, Coordinate3D coordinate) : _block(block), _coordinate(new Coordinate3D(coordinate)) {}
+            LevelObject(Block block, Coordinate3D coordinate) : _block(std::move(block)), _coordinate(coordinate), _is2D(false) {}
 
             /**
              * Gets the block of the object.
              * @return Block of the object.
              */
-            inline Block block() {
+            inline const Block& block() const {
                 return _block;
             }
-            
+
+            /**
+             * Whether the object has a 2D coordinate.
+             * @return true if the coordinate is 2D, false if it is 3D
+             */
+            inline bool is2D() const {
+                return _is2D;
+            }
+
+            /**
+             * Gets the coordinate of a 2D object.
+             * @return Coordinate of the object.
+             */
+            inline Coordinate2D coordinate2D() const {
+                return Coordinate2D(_coordinate.x, _coordinate.y);
+            }
+
             /**
-             * Gets the coordinate of the object.
+             * Gets the coordinate of a 3D object. 2D objects report a Z coordinate of 0.
              * @return Coordinate of the object.
              */
-            inline Coordinate* coordinate() {
+            inline Coordinate3D coordinate3D() const {
                 return _coordinate;
             }
 
+            /**
+             * Gets the magnitude of the object's coordinate.
+             * @return Coordinate Magnitude
+             */
+            inline double getMagnitude() const {
+                return _coordinate.getMagnitude();
+            }
+
             /**
              * Compares two LevelObjects for equality.
              * @param other The other LevelObject to compare to.
              * @return True if the LevelObjects are equal, false otherwise.
              */
             bool operator==(const LevelObject& other) const {
-                return _block == other._block && _coordinate->getMagnitude() == other._coordinate->getMagnitude();
+                return _is2D == other._is2D && _coordinate == other._coordinate && _block == other._block;
             }
 
             /**
@@ -160,7 +551,7 @@ namespace LevelZ {
              * @return True if the LevelObjects are not equal, false otherwise.
              */
             bool operator!=(const LevelObject& other) const {
-                return _block != other._block || _coordinate->getMagnitude() != other._coordinate->getMagnitude();
+                return !(*this == other);
             }
 
             /**
@@ -168,7 +559,7 @@ namespace LevelZ {
              * @return The string representation of this LevelObject.
              */
             std::string to_string() const {
-                return _block.to_string() + ": " + _coordinate->to_string();
+                return _block.to_string() + ": " + (_is2D ? coordinate2D().to_string() : _coordinate.to_string());
             }
 
             /**
@@ -181,4 +572,34 @@ namespace LevelZ {
             }
     };
 
+}
+
+namespace std {
+
+    /**
+     * Hashes a block by its name and properties, independent of property order.
+     */
+    template <>
+    struct hash<LevelZ::Block> {
+        size_t operator()(const LevelZ::Block& b) const noexcept {
+            std::hash<std::string> h;
+            size_t properties = 0;
+            for (auto const& [k, v] : b.properties)
+                properties += LevelZ::hash_combine(h(k), h(v));
+
+            return LevelZ::hash_combine(h(b.name), properties);
+        }
+    };
+
+    /**
+     * Hashes a LevelObject by its block and coordinate, consistent with LevelObject::operator==.
+     */
+    template <>
+    struct hash<LevelZ::LevelObject> {
+        size_t operator()(const LevelZ::LevelObject& o) const noexcept {
+            size_t coordinate = o.is2D() ? std::hash<LevelZ::Coordinate2D>()(o.coordinate2D()) : std::hash<LevelZ::Coordinate3D>()(o.coordinate3D());
+            return LevelZ::hash_combine(coordinate, std::hash<LevelZ::Block>()(o.block()));
+        }
+    };
+
 }
\ No newline at end of file
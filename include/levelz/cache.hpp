@@ -0,0 +1,248 @@
+#pragma once
+
+#include <string>
+#include <atomic>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <filesystem>
+#include <string_view>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define LEVELZ_MMAP 1
+#endif
+
+#include "../levelz.hpp"
+#include "binary.hpp"
+
+namespace LevelZ {
+
+    /**
+     * A read-only view of a whole file, memory mapped where the platform supports it and read into memory otherwise.
+     */
+    struct MappedFile {
+        private:
+            const char* _data = nullptr;
+            size_t _size = 0;
+            std::string _buffer;
+            bool _mapped = false;
+
+        public:
+            /**
+             * Opens and maps a file.
+             * @param file The file to map.
+             * @throws std::invalid_argument if the file cannot be opened.
+             */
+            explicit MappedFile(const std::string& file) {
+#ifdef LEVELZ_MMAP
+                int fd = ::open(file.c_str(), O_RDONLY);
+                if (fd < 0) throw std::invalid_argument("Could not open file: " + file);
+
+                struct stat st{};
+                if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+                    void* p = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (p != MAP_FAILED) {
+                        _data = static_cast<const char*>(p);
+                        _size = static_cast<size_t>(st.st_size);
+                        _mapped = true;
+                    }
+                }
+
+                ::close(fd);
+                if (_mapped || st.st_size == 0) return;
+#endif
+                std::ifstream stream(file, std::ios::binary);
+                if (!stream) throw std::invalid_argument("Could not open file: " + file);
+
+                _buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+                _data = _buffer.data();
+                _size = _buffer.size();
+            }
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            ~MappedFile() {
+#ifdef LEVELZ_MMAP
+                if (_mapped) ::munmap(const_cast<char*>(_data), _size);
+#endif
+            }
+
+            /**
+             * Gets the contents of the file.
+             * @return A pointer to the first byte.
+             */
+            inline const char* data() const {
+                return _data;
+            }
+
+            /**
+             * Gets the size of the file.
+             * @return The number of bytes.
+             */
+            inline size_t size() const {
+                return _size;
+            }
+
+            /**
+             * Gets whether the file is memory mapped, rather than read into memory.
+             * @return true if mapped, false otherwise
+             */
+            inline bool mapped() const {
+                return _mapped;
+            }
+
+            /**
+             * Gets the contents of the file as a string view.
+             * @return The contents of the file.
+             */
+            inline std::string_view view() const {
+                return std::string_view(_data, _size);
+            }
+    };
+
+    /**
+     * A persistent cache of parsed levels, keyed by the XXH64 hash of their source.
+     *
+     * Each cached level is stored in the cache directory in the binary format of serializeLevel, prefixed with the hash and size
+     * of its source. Cached files are memory mapped when read. Stale, truncated or corrupt entries are ignored and rewritten.
+     * Entries are written to a temporary file and renamed, so concurrent processes sharing a directory never see partial entries.
+     */
+    struct LevelCache {
+        private:
+            std::filesystem::path _directory;
+            std::atomic<size_t> _hits{0};
+            std::atomic<size_t> _misses{0};
+
+            struct Entry {
+                uint64_t hash;
+                uint64_t size;
+            };
+
+        public:
+            /**
+             * Constructs a new cache in the specified directory, creating it if necessary.
+             * @param directory The directory to store cached levels in.
+             */
+            explicit LevelCache(const std::filesystem::path& directory) : _directory(directory) {
+                std::filesystem::create_directories(_directory);
+            }
+
+            /**
+             * Gets the cache directory.
+             * @return The directory of the cache.
+             */
+            inline const std::filesystem::path& directory() const {
+                return _directory;
+            }
+
+            /**
+             * Gets the number of loads served from the cache.
+             * @return The number of hits.
+             */
+            inline size_t hits() const {
+                return _hits.load();
+            }
+
+            /**
+             * Gets the number of loads that parsed the source.
+             * @return The number of misses.
+             */
+            inline size_t misses() const {
+                return _misses.load();
+            }
+
+            /**
+             * Gets the path of the cache entry for a source hash.
+             * @param hash The hash of the source, combined with the parse options.
+             * @return The path of the entry.
+             */
+            std::filesystem::path path(uint64_t hash) const {
+                char name[32];
+                std::snprintf(name, sizeof(name), "%016llx.lvzb", static_cast<unsigned long long>(hash));
+                return _directory / name;
+            }
+
+            /**
+             * Loads a level, from the cache if its source is unchanged, or by parsing it and storing the result.
+             * @param file The level file to load.
+             * @param options The options to parse the level with. Levels parsed with different block options are cached separately.
+             * @return The level.
+             * @throws std::invalid_argument if the file cannot be opened.
+             */
+            Level load(const std::string& file, const ParseOptions& options = ParseOptions()) {
+                MappedFile source(file);
+                const uint64_t hash = xxhash64(source.data(), source.size(), (options.deduplicate ? 1 : 0) | (options.spatialOrder ? 2 : 0));
+                const std::filesystem::path entry = path(hash);
+
+                std::error_code error;
+                if (std::filesystem::exists(entry, error)) {
+                    try {
+                        MappedFile cached(entry.string());
+                        Entry header;
+                        if (cached.size() >= sizeof(header)) {
+                            std::memcpy(&header, cached.data(), sizeof(header));
+
+                            if (header.hash == hash && header.size == source.size()) {
+                                Level level = deserializeLevel(cached.data() + sizeof(header), cached.size() - sizeof(header), options.resource);
+                                _hits++;
+                                return level;
+                            }
+                        }
+                    } catch (const std::invalid_argument&) {}
+                }
+
+                _misses++;
+                ParseRecorder recorder(options);
+                LineList lines(resourceOf(options));
+                splitLines(source.view(), lines);
+
+                Level level = parseLevel(lines, options, recorder);
+                store(entry, Entry{hash, source.size()}, level);
+                return level;
+            }
+
+            /**
+             * Removes every entry from the cache.
+             */
+            void clear() {
+                std::error_code error;
+                for (const auto& e : std::filesystem::directory_iterator(_directory, error))
+                    if (e.path().extension() == ".lvzb")
+                        std::filesystem::remove(e.path(), error);
+            }
+
+        private:
+            static void store(const std::filesystem::path& entry, const Entry& header, const Level& level) {
+                std::filesystem::path temp = entry;
+                temp += "." + std::to_string(std::random_device()()) + ".tmp";
+
+                {
+                    std::ofstream out(temp, std::ios::binary);
+                    if (!out) return;
+
+                    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                    serializeLevel(level, out);
+                    if (!out) {
+                        out.close();
+                        std::error_code error;
+                        std::filesystem::remove(temp, error);
+                        return;
+                    }
+                }
+
+                std::error_code error;
+                std::filesystem::rename(temp, entry, error);
+                if (error) std::filesystem::remove(temp, error);
+            }
+    };
+
+}
@@ -0,0 +1,303 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <istream>
+#include <ostream>
+#include <fstream>
+#include <streambuf>
+#include <stdexcept>
+#include <string_view>
+
+#include <zlib.h>
+
+#include "../levelz.hpp"
+
+namespace LevelZ {
+
+    /**
+     * The container format of compressed output. Compressed input is detected automatically.
+     */
+    enum class CompressionFormat {
+        /**
+         * The gzip format, as written by the gzip tool.
+         */
+        GZIP,
+
+        /**
+         * The zlib format.
+         */
+        ZLIB
+    };
+
+    /**
+     * Decompresses gzip or zlib data from a stream chunk by chunk, without holding the whole contents in memory.
+     *
+     * Concatenated gzip members are read one after another, as the gzip tool does.
+     */
+    struct CompressedInput {
+        private:
+            std::istream& _source;
+            z_stream _stream{};
+            std::vector<char> _in;
+            std::vector<char> _out;
+            size_t _compressed = 0;
+            size_t _bytes = 0;
+            bool _pending = false;
+            bool _done = false;
+
+        public:
+            /**
+             * Constructs a new decompressor.
+             * @param source The stream to read compressed data from.
+             * @param chunkSize The number of bytes to read and decompress at a time.
+             * @throws std::invalid_argument if the chunk size is 0.
+             */
+            explicit CompressedInput(std::istream& source, size_t chunkSize = 64 * 1024) : _source(source), _in(chunkSize), _out(chunkSize) {
+                if (chunkSize == 0) throw std::invalid_argument("Chunk size must be positive");
+
+                // 32 enables automatic detection of gzip and zlib headers
+                if (inflateInit2(&_stream, 15 + 32) != Z_OK) throw std::runtime_error("Could not initialize zlib");
+            }
+
+            CompressedInput(const CompressedInput&) = delete;
+            CompressedInput& operator=(const CompressedInput&) = delete;
+
+            ~CompressedInput() {
+                inflateEnd(&_stream);
+            }
+
+            /**
+             * Gets the number of compressed bytes read.
+             * @return The number of bytes.
+             */
+            inline size_t compressedBytes() const {
+                return _compressed;
+            }
+
+            /**
+             * Gets the number of decompressed bytes produced.
+             * @return The number of bytes.
+             */
+            inline size_t bytes() const {
+                return _bytes;
+            }
+
+            /**
+             * Decompresses the next chunk.
+             * @return The decompressed bytes, valid until the next call, or an empty view at the end of the data.
+             * @throws std::invalid_argument if the data is corrupt or truncated.
+             */
+            std::string_view next() {
+                while (!_done) {
+                    if (_stream.avail_in == 0) {
+                        _source.read(_in.data(), static_cast<std::streamsize>(_in.size()));
+                        size_t read = static_cast<size_t>(_source.gcount());
+                        if (read == 0) {
+                            if (_pending) throw std::invalid_argument("Truncated compressed level");
+                            _done = true;
+                            break;
+                        }
+
+                        _compressed += read;
+                        _stream.next_in = reinterpret_cast<Bytef*>(_in.data());
+                        _stream.avail_in = static_cast<uInt>(read);
+                    }
+
+                    _stream.next_out = reinterpret_cast<Bytef*>(_out.data());
+                    _stream.avail_out = static_cast<uInt>(_out.size());
+
+                    int result = inflate(&_stream, Z_NO_FLUSH);
+                    if (result == Z_STREAM_END) {
+                        _pending = false;
+                        inflateReset(&_stream);
+                    } else if (result == Z_OK || result == Z_BUF_ERROR)
+                        _pending = true;
+                    else
+                        throw std::invalid_argument("Corrupt compressed level");
+
+                    size_t produced = _out.size() - _stream.avail_out;
+                    if (produced > 0) {
+                        _bytes += produced;
+                        return std::string_view(_out.data(), produced);
+                    }
+                }
+
+                return std::string_view();
+            }
+    };
+
+    /**
+     * A stream buffer that compresses everything written to it into another stream.
+     */
+    struct CompressedOutputBuffer : public std::streambuf {
+        private:
+            std::ostream& _target;
+            z_stream _stream{};
+            std::vector<char> _buffer;
+            std::vector<char> _chunk;
+            bool _finished = false;
+
+            bool deflateBuffer(int flush) {
+                _stream.next_in = reinterpret_cast<Bytef*>(pbase());
+                _stream.avail_in = static_cast<uInt>(pptr() - pbase());
+
+                do {
+                    _stream.next_out = reinterpret_cast<Bytef*>(_chunk.data());
+                    _stream.avail_out = static_cast<uInt>(_chunk.size());
+
+                    if (deflate(&_stream, flush) == Z_STREAM_ERROR) return false;
+
+                    _target.write(_chunk.data(), static_cast<std::streamsize>(_chunk.size() - _stream.avail_out));
+                    if (!_target) return false;
+                } while (_stream.avail_out == 0);
+
+                setp(_buffer.data(), _buffer.data() + _buffer.size());
+                return true;
+            }
+
+        protected:
+            int_type overflow(int_type c) override {
+                if (_finished || !deflateBuffer(Z_NO_FLUSH)) return traits_type::eof();
+                if (traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+
+                *pptr() = traits_type::to_char_type(c);
+                pbump(1);
+                return c;
+            }
+
+            int sync() override {
+                if (_finished) return 0;
+                if (!deflateBuffer(Z_SYNC_FLUSH)) return -1;
+
+                _target.flush();
+                return _target ? 0 : -1;
+            }
+
+        public:
+            /**
+             * Constructs a new compressing buffer.
+             * @param target The stream to write compressed data to.
+             * @param compression The zlib compression level, from 0 to 9, or Z_DEFAULT_COMPRESSION.
+             * @param format The container format to write.
+             * @throws std::invalid_argument if the compression level is invalid.
+             */
+            explicit CompressedOutputBuffer(std::ostream& target, int compression = Z_DEFAULT_COMPRESSION, CompressionFormat format = CompressionFormat::GZIP) : _target(target), _buffer(64 * 1024), _chunk(64 * 1024) {
+                // 16 selects a gzip header and trailer instead of a zlib one
+                int bits = format == CompressionFormat::GZIP ? 15 + 16 : 15;
+                if (deflateInit2(&_stream, compression, Z_DEFLATED, bits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+                    throw std::invalid_argument("Invalid compression level " + std::to_string(compression));
+
+                setp(_buffer.data(), _buffer.data() + _buffer.size());
+            }
+
+            CompressedOutputBuffer(const CompressedOutputBuffer&) = delete;
+            CompressedOutputBuffer& operator=(const CompressedOutputBuffer&) = delete;
+
+            ~CompressedOutputBuffer() override {
+                finish();
+                deflateEnd(&_stream);
+            }
+
+            /**
+             * Compresses the remaining data and writes the end of the compressed stream. Later writes fail.
+             * @return true if everything was written, false otherwise
+             */
+            bool finish() {
+                if (_finished) return true;
+
+                _finished = true;
+                return deflateBuffer(Z_FINISH);
+            }
+    };
+
+    /**
+     * An output stream that compresses everything written to it into another stream.
+     */
+    struct CompressedOutput : public std::ostream {
+        private:
+            CompressedOutputBuffer _buffer;
+
+        public:
+            /**
+             * Constructs a new compressing stream.
+             * @param target The stream to write compressed data to.
+             * @param compression The zlib compression level, from 0 to 9, or Z_DEFAULT_COMPRESSION.
+             * @param format The container format to write.
+             * @throws std::invalid_argument if the compression level is invalid.
+             */
+            explicit CompressedOutput(std::ostream& target, int compression = Z_DEFAULT_COMPRESSION, CompressionFormat format = CompressionFormat::GZIP) : std::ostream(nullptr), _buffer(target, compression, format) {
+                rdbuf(&_buffer);
+            }
+
+            /**
+             * Writes the end of the compressed stream. Called automatically on destruction.
+             */
+            void finish() {
+                if (!_buffer.finish()) setstate(std::ios::badbit);
+            }
+    };
+
+    /**
+     * Parses a gzip or zlib compressed level from a stream, decompressing and parsing it chunk by chunk.
+     * @param in The stream to read the compressed level from.
+     * @param options The options to parse the level with.
+     * @return The parsed level.
+     * @throws std::invalid_argument if the data is corrupt or a line is malformed.
+     * @throws std::out_of_range if the level has no header section.
+     */
+    inline Level parseCompressed(std::istream& in, const ParseOptions& options = ParseOptions()) {
+        CompressedInput input(in);
+        LevelParser parser(options);
+
+        for (std::string_view chunk = input.next(); !chunk.empty(); chunk = input.next())
+            parser.feed(chunk);
+
+        return parser.finish();
+    }
+
+    /**
+     * Parses a gzip or zlib compressed level file, decompressing and parsing it chunk by chunk.
+     * @param file The compressed file to read the level from.
+     * @param options The options to parse the level with.
+     * @return The parsed level.
+     * @throws std::invalid_argument if the file cannot be opened or is corrupt.
+     * @throws std::out_of_range if the level has no header section.
+     */
+    inline Level parseCompressedFile(const std::string& file, const ParseOptions& options = ParseOptions()) {
+        std::ifstream in(file, std::ios::binary);
+        if (!in) throw std::invalid_argument("Could not open file: " + file);
+
+        return parseCompressed(in, options);
+    }
+
+    /**
+     * Writes a compressed level to a stream, compressing it as it is written.
+     * @param level The level to write.
+     * @param out The stream to write the compressed level to.
+     * @param compression The zlib compression level, from 0 to 9, or Z_DEFAULT_COMPRESSION.
+     * @param format The container format to write.
+     * @throws std::invalid_argument if the compression level is invalid.
+     */
+    inline void writeCompressed(const Level& level, std::ostream& out, int compression = Z_DEFAULT_COMPRESSION, CompressionFormat format = CompressionFormat::GZIP) {
+        CompressedOutput compressed(out, compression, format);
+        LevelWriter(compressed).write(level);
+        compressed.finish();
+    }
+
+    /**
+     * Writes a compressed level to a file, compressing it as it is written.
+     * @param level The level to write.
+     * @param file The file to write the compressed level to.
+     * @param compression The zlib compression level, from 0 to 9, or Z_DEFAULT_COMPRESSION.
+     * @param format The container format to write.
+     * @throws std::invalid_argument if the file cannot be opened or the compression level is invalid.
+     */
+    inline void writeCompressedFile(const Level& level, const std::string& file, int compression = Z_DEFAULT_COMPRESSION, CompressionFormat format = CompressionFormat::GZIP) {
+        std::ofstream out(file, std::ios::binary);
+        if (!out) throw std::invalid_argument("Could not open file: " + file);
+
+        writeCompressed(level, out, compression, format);
+    }
+
+}
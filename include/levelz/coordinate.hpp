@@ -1,31 +1,117 @@
 #pragma once
 
+#include <string>
 #include <vector>
 #include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <functional>
+#include <string_view>
+#include <type_traits>
 
 namespace LevelZ {
 
     /**
-     * Represents a LevelZ Coordinate.
+     * Combines a hash value into a seed.
+     * @param seed The existing hash.
+     * @param value The hash to combine into the seed.
+     * @return The combined hash.
      */
-    struct Coordinate {
-        /**
-         * Converts this coordinate to a string.
-         * @return The string representation of the coordinate.
-         */
-        virtual std::string to_string() const = 0;
-
-        /**
-         * Gets the magnitude of the coordinate.
-         * @return Coordinate Magnitude
-         */
-        virtual double getMagnitude() const = 0;
-    };
+    inline size_t hash_combine(size_t seed, size_t value) {
+        return seed ^ (value + static_cast<size_t>(0x9e3779b97f4a7c15ULL) + (seed << 6) + (seed >> 2));
+    }
+
+    /**
+     * Hashes a coordinate component so that 0.0 and -0.0, which compare equal, hash equally.
+     * @param value The component to hash.
+     * @return The hash of the component.
+     */
+    inline size_t hash_component(double value) {
+        return std::hash<double>()(value == 0 ? 0.0 : value);
+    }
+
+    /**
+     * Removes leading and trailing whitespace from a string.
+     * @param str The string to trim.
+     * @return A view of the string without the surrounding whitespace.
+     */
+    constexpr std::string_view trimView(std::string_view str) {
+        size_t first = 0;
+        size_t last = str.size();
+        while (first < last && (str[first] == ' ' || str[first] == '\t' || str[first] == '\r' || str[first] == '\n')) first++;
+        while (last > first && (str[last - 1] == ' ' || str[last - 1] == '\t' || str[last - 1] == '\r' || str[last - 1] == '\n')) last--;
+        return str.substr(first, last - first);
+    }
+
+    /**
+     * Parses a decimal number, usable in constant expressions.
+     *
+     * Numbers with at most 15 significant digits and a small exponent, such as typical coordinates, are rounded exactly like std::strtod.
+     * Longer numbers may differ from std::strtod in the last bit.
+     * @param str The number to parse, such as "-1.5" or "2e3".
+     * @return The parsed number.
+     * @throws std::invalid_argument if the string is not a number.
+     */
+    constexpr double parseNumber(std::string_view str) {
+        str = trimView(str);
+
+        size_t i = 0;
+        bool negative = false;
+        if (i < str.size() && (str[i] == '-' || str[i] == '+')) negative = str[i++] == '-';
+
+        uint64_t mantissa = 0;
+        int digits = 0;
+        int exponent = 0;
+        bool any = false;
+
+        for (; i < str.size() && str[i] >= '0' && str[i] <= '9'; i++, any = true) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(str[i] - '0');
+                if (mantissa != 0) digits++;
+            } else
+                exponent++;
+        }
+
+        if (i < str.size() && str[i] == '.')
+            for (i++; i < str.size() && str[i] >= '0' && str[i] <= '9'; i++, any = true) {
+                if (digits < 19) {
+                    mantissa = mantissa * 10 + static_cast<uint64_t>(str[i] - '0');
+                    if (mantissa != 0) digits++;
+                    exponent--;
+                }
+            }
+
+        if (!any) throw std::invalid_argument("Invalid number");
+
+        if (i < str.size() && (str[i] == 'e' || str[i] == 'E')) {
+            i++;
+            bool negativeExponent = false;
+            if (i < str.size() && (str[i] == '-' || str[i] == '+')) negativeExponent = str[i++] == '-';
+
+            int e = 0;
+            for (; i < str.size() && str[i] >= '0' && str[i] <= '9'; i++)
+                if (e < 10000) e = e * 10 + (str[i] - '0');
+
+            exponent += negativeExponent ? -e : e;
+        }
+
+        // exact when the mantissa and the power of ten are both representable, as in std::strtod
+        double value = static_cast<double>(mantissa);
+        double scale = 1.0;
+        int magnitude = exponent < 0 ? -exponent : exponent;
+        for (int k = 0; k < magnitude && k < 400; k++) scale *= 10.0;
+
+        value = exponent < 0 ? value / scale : value * scale;
+        return negative ? -value : value;
+    }
 
     /**
      * Represents a 2D coordinate.
+     * 
+     * Coordinates are plain, trivially copyable values laid out as consecutive doubles, 
+     * so arrays of them can be processed by the batch kernels in transform.hpp.
      */
-    struct Coordinate2D : Coordinate {
+    struct Coordinate2D {
         public:
             /**
              * The X coordinate.
@@ -40,21 +126,21 @@ namespace LevelZ {
             /**
              * Initializes a new instance of the Coordinate2D class at [0, 0].
              */
-            Coordinate2D() : x(0), y(0) {}
+            constexpr Coordinate2D() : x(0), y(0) {}
 
             /**
              * Initializes a new instance of the Coordinate2D class at the specified coordinates.
              * @param x The X coordinate.
              * @param y The Y coordinate.
              */
-            Coordinate2D(int x, int y) : x(x), y(y) {}
+            constexpr Coordinate2D(int x, int y) : x(x), y(y) {}
 
             /**
              * Initializes a new instance of the Coordinate2D class at the specified coordinates.
              * @param x The X coordinate.
              * @param y The Y coordinate.
              */
-            Coordinate2D(double x, double y) : x(x), y(y) {}
+            constexpr Coordinate2D(double x, double y) : x(x), y(y) {}
 
             /**
              * Initializes a new instance of the Coordinate2D class at the specified coordinates.
@@ -93,7 +179,7 @@ namespace LevelZ {
              * @param other The other coordinate to compare to.
              * @return True if the coordinates are equal, false otherwise.
              */
-            bool operator==(const Coordinate2D& other) const {
+            constexpr bool operator==(const Coordinate2D& other) const {
                 return x == other.x && y == other.y;
             }
 
@@ -102,7 +188,7 @@ namespace LevelZ {
              * @param other The other coordinate to compare to.
              * @return True if the coordinates are not equal, false otherwise.
              */
-            bool operator!=(const Coordinate2D& other) const {
+            constexpr bool operator!=(const Coordinate2D& other) const {
                 return x != other.x || y != other.y;
             }
 
@@ -111,7 +197,7 @@ namespace LevelZ {
              * @param other The other coordinate to add.
              * @return The sum of the two coordinates.
              */
-            Coordinate2D operator+(const Coordinate2D& other) const {
+            constexpr Coordinate2D operator+(const Coordinate2D& other) const {
                 return Coordinate2D(x + other.x, y + other.y);
             }
 
@@ -120,7 +206,7 @@ namespace LevelZ {
              * @param other The other coordinate to subtract.
              * @return The difference of the two coordinates.
              */
-            Coordinate2D operator-(const Coordinate2D& other) const {
+            constexpr Coordinate2D operator-(const Coordinate2D& other) const {
                 return Coordinate2D(x - other.x, y - other.y);
             }
 
@@ -129,7 +215,7 @@ namespace LevelZ {
              * @param scalar The scalar to multiply by.
              * @return The product of the coordinate and the scalar.
              */
-            Coordinate2D operator*(int scalar) const {
+            constexpr Coordinate2D operator*(double scalar) const {
                 return Coordinate2D(x * scalar, y * scalar);
             }
 
@@ -138,7 +224,7 @@ namespace LevelZ {
              * @param scalar The scalar to divide by.
              * @return The quotient of the coordinate and the scalar.
              */
-            Coordinate2D operator/(int scalar) const {
+            constexpr Coordinate2D operator/(double scalar) const {
                 return Coordinate2D(x / scalar, y / scalar);
             }
 
@@ -169,12 +255,32 @@ namespace LevelZ {
                 std::string y = str.substr(str.find(",") + 1, str.find("]") - str.find(",") - 1);
                 return Coordinate2D(std::stod(x), std::stod(y));
             }
+
+            /**
+             * Parses a 2D coordinate such as "[1, 2]", usable in constant expressions.
+             * @param str The string to parse.
+             * @return The parsed coordinate.
+             * @throws std::invalid_argument if the string is not a 2D coordinate.
+             */
+            static constexpr Coordinate2D parse(std::string_view str) {
+                str = trimView(str);
+                if (str.size() < 2 || str.front() != '[' || str.back() != ']') throw std::invalid_argument("Invalid 2D coordinate");
+
+                std::string_view values = str.substr(1, str.size() - 2);
+                size_t comma = values.find(',');
+                if (comma == std::string_view::npos) throw std::invalid_argument("Invalid 2D coordinate");
+
+                return Coordinate2D(parseNumber(values.substr(0, comma)), parseNumber(values.substr(comma + 1)));
+            }
     };
 
     /**
      * Represents a 3D coordinate.
+     * 
+     * Coordinates are plain, trivially copyable values laid out as consecutive doubles, 
+     * so arrays of them can be processed by the batch kernels in transform.hpp.
      */
-    struct Coordinate3D : Coordinate {
+    struct Coordinate3D {
         public:
             /**
              * The X coordinate.
@@ -194,7 +300,7 @@ namespace LevelZ {
             /**
              * Initializes a new instance of the Coordinate3D class at [0, 0, 0].
              */
-            Coordinate3D() : x(0), y(0), z(0) {}
+            constexpr Coordinate3D() : x(0), y(0), z(0) {}
 
             /**
              * Initializes a new instance of the Coordinate3D class at the specified coordinates.
@@ -202,7 +308,7 @@ namespace LevelZ {
              * @param y The Y coordinate.
              * @param z The Z coordinate.
              */
-            Coordinate3D(int x, int y, int z) : x(x), y(y), z(z) {}
+            constexpr Coordinate3D(int x, int y, int z) : x(x), y(y), z(z) {}
 
             /**
              * Initializes a new instance of the Coordinate3D class at the specified coordinates.
@@ -210,7 +316,7 @@ namespace LevelZ {
              * @param y The Y coordinate.
              * @param z The Z coordinate.
              */
-            Coordinate3D(double x, double y, double z) : x(x), y(y), z(z) {}
+            constexpr Coordinate3D(double x, double y, double z) : x(x), y(y), z(z) {}
 
             /**
              * Initializes a new instance of the Coordinate3D class at the specified coordinates.
@@ -249,7 +355,7 @@ namespace LevelZ {
              * @param other The other coordinate to compare to.
              * @return True if the coordinates are equal, false otherwise.
              */
-            bool operator==(const Coordinate3D& other) const {
+            constexpr bool operator==(const Coordinate3D& other) const {
                 return x == other.x && y == other.y && z == other.z;
             }
 
@@ -258,7 +364,7 @@ namespace LevelZ {
              * @param other The other coordinate to compare to.
              * @return True if the coordinates are not equal, false otherwise.
              */
-            bool operator!=(const Coordinate3D& other) const {
+            constexpr bool operator!=(const Coordinate3D& other) const {
                 return x != other.x || y != other.y || z != other.z;
             }
 
@@ -267,7 +373,7 @@ namespace LevelZ {
              * @param other The other coordinate to add.
              * @return The sum of the two coordinates.
              */
-            Coordinate3D operator+(const Coordinate3D& other) const {
+            constexpr Coordinate3D operator+(const Coordinate3D& other) const {
                 return Coordinate3D(x + other.x, y + other.y, z + other.z);
             }
 
@@ -276,7 +382,7 @@ namespace LevelZ {
              * @param other The other coordinate to subtract.
              * @return The difference of the two coordinates.
              */
-            Coordinate3D operator-(const Coordinate3D& other) const {
+            constexpr Coordinate3D operator-(const Coordinate3D& other) const {
                 return Coordinate3D(x - other.x, y - other.y, z - other.z);
             }
 
@@ -285,7 +391,7 @@ namespace LevelZ {
              * @param scalar The scalar to multiply by.
              * @return The product of the coordinate and the scalar.
              */
-            Coordinate3D operator*(int scalar) const {
+            constexpr Coordinate3D operator*(double scalar) const {
                 return Coordinate3D(x * scalar, y * scalar, z * scalar);
             }
 
@@ -294,7 +400,7 @@ namespace LevelZ {
              * @param scalar The scalar to divide by.
              * @return The quotient of the coordinate and the scalar.
              */
-            Coordinate3D operator/(int scalar) const {
+            constexpr Coordinate3D operator/(double scalar) const {
                 return Coordinate3D(x / scalar, y / scalar, z / scalar);
             }
 
@@ -326,5 +432,50 @@ namespace LevelZ {
                 std::string z = str.substr(str.rfind(",") + 1, str.find("]") - str.rfind(",") - 1);
                 return Coordinate3D(std::stod(x), std::stod(y), std::stod(z));
             }
+
+            /**
+             * Parses a 3D coordinate such as "[1, 2, 3]", usable in constant expressions.
+             * @param str The string to parse.
+             * @return The parsed coordinate.
+             * @throws std::invalid_argument if the string is not a 3D coordinate.
+             */
+            static constexpr Coordinate3D parse(std::string_view str) {
+                str = trimView(str);
+                if (str.size() < 2 || str.front() != '[' || str.back() != ']') throw std::invalid_argument("Invalid 3D coordinate");
+
+                std::string_view values = str.substr(1, str.size() - 2);
+                size_t first = values.find(',');
+                size_t second = first == std::string_view::npos ? first : values.find(',', first + 1);
+                if (second == std::string_view::npos) throw std::invalid_argument("Invalid 3D coordinate");
+
+                return Coordinate3D(parseNumber(values.substr(0, first)), parseNumber(values.substr(first + 1, second - first - 1)), parseNumber(values.substr(second + 1)));
+            }
+    };
+
+    static_assert(std::is_trivially_copyable<Coordinate2D>::value && std::is_standard_layout<Coordinate2D>::value && sizeof(Coordinate2D) == 2 * sizeof(double), "Coordinate2D must be a plain pair of doubles");
+    static_assert(std::is_trivially_copyable<Coordinate3D>::value && std::is_standard_layout<Coordinate3D>::value && sizeof(Coordinate3D) == 3 * sizeof(double), "Coordinate3D must be a plain triple of doubles");
+}
+
+namespace std {
+
+    /**
+     * Hashes a 2D coordinate, consistent with Coordinate2D::operator==.
+     */
+    template <>
+    struct hash<LevelZ::Coordinate2D> {
+        size_t operator()(const LevelZ::Coordinate2D& c) const noexcept {
+            return LevelZ::hash_combine(LevelZ::hash_component(c.x), LevelZ::hash_component(c.y));
+        }
     };
+
+    /**
+     * Hashes a 3D coordinate, consistent with Coordinate3D::operator==.
+     */
+    template <>
+    struct hash<LevelZ::Coordinate3D> {
+        size_t operator()(const LevelZ::Coordinate3D& c) const noexcept {
+            return LevelZ::hash_combine(LevelZ::hash_combine(LevelZ::hash_component(c.x), LevelZ::hash_component(c.y)), LevelZ::hash_component(c.z));
+        }
+    };
+
 }
\ No newline at end of file
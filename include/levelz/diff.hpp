@@ -0,0 +1,183 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+
+#include "block.hpp"
+#include "coordinate.hpp"
+#include "level.hpp"
+
+namespace LevelZ {
+
+    /**
+     * Represents a block that was replaced by a different block at the same coordinate.
+     */
+    struct BlockChange {
+        /**
+         * The block before the change.
+         */
+        LevelObject before;
+
+        /**
+         * The block after the change.
+         */
+        LevelObject after;
+    };
+
+    /**
+     * Represents the differences between two levels.
+     */
+    struct LevelDiff {
+        public:
+            /**
+             * The blocks at coordinates that only exist in the new level.
+             */
+            std::vector<LevelObject> added;
+
+            /**
+             * The blocks at coordinates that only exist in the old level.
+             */
+            std::vector<LevelObject> removed;
+
+            /**
+             * The blocks that differ at coordinates that exist in both levels.
+             */
+            std::vector<BlockChange> changed;
+
+            /**
+             * The headers that were added or whose values changed, with their new values.
+             */
+            std::unordered_map<std::string, std::string> headersSet;
+
+            /**
+             * The headers that only exist in the old level.
+             */
+            std::vector<std::string> headersRemoved;
+
+            /**
+             * Whether the levels are identical.
+             * @return true if there are no differences, false otherwise
+             */
+            bool empty() const {
+                return added.empty() && removed.empty() && changed.empty() && headersSet.empty() && headersRemoved.empty();
+            }
+
+            /**
+             * Gets the total number of differences.
+             * @return The number of added, removed and changed blocks and headers.
+             */
+            size_t size() const {
+                return added.size() + removed.size() + changed.size() + headersSet.size() + headersRemoved.size();
+            }
+    };
+
+    /**
+     * Computes the differences between two levels in O(n).
+     *
+     * Levels are compared as maps of coordinates to blocks, regardless of block order. When a level
+     * places several blocks at the same coordinate, the last one wins, as with ParseOptions::deduplicate.
+     * @param from The old level.
+     * @param to The new level.
+     * @return The differences between the levels.
+     */
+    inline LevelDiff diff(const Level& from, const Level& to) {
+        LevelDiff result;
+
+        if (from.fingerprint() == to.fingerprint() && from == to) return result;
+
+        for (auto const& [k, v] : to.headers()) {
+            auto it = from.headers().find(k);
+            if (it == from.headers().end() || it->second != v)
+                result.headersSet[k] = v;
+        }
+
+        for (auto const& [k, v] : from.headers())
+            if (to.headers().find(k) == to.headers().end())
+                result.headersRemoved.push_back(k);
+
+        const BlockList& a = from.blocks();
+        const BlockList& b = to.blocks();
+
+        std::unordered_map<Coordinate3D, size_t> index;
+        index.reserve(a.size());
+        for (size_t i = 0; i < a.size(); i++)
+            index[a[i].coordinate3D()] = i;
+
+        std::unordered_map<Coordinate3D, size_t> last;
+        last.reserve(b.size());
+        for (size_t i = 0; i < b.size(); i++)
+            last[b[i].coordinate3D()] = i;
+
+        std::vector<bool> matched(a.size());
+        for (size_t i = 0; i < b.size(); i++) {
+            auto l = last.find(b[i].coordinate3D());
+            if (l->second != i) continue;
+
+            auto it = index.find(b[i].coordinate3D());
+            if (it == index.end()) {
+                result.added.push_back(b[i]);
+                continue;
+            }
+
+            matched[it->second] = true;
+            if (a[it->second].block() != b[i].block())
+                result.changed.push_back(BlockChange{a[it->second], b[i]});
+        }
+
+        for (size_t i = 0; i < a.size(); i++)
+            if (!matched[i] && index[a[i].coordinate3D()] == i)
+                result.removed.push_back(a[i]);
+
+        return result;
+    }
+
+    /**
+     * Applies the differences to a level, producing the new level.
+     * @param level The level to patch, usually the old level the differences were computed from.
+     * @param diff The differences to apply.
+     * @return The patched level, with its blocks deduplicated.
+     */
+    inline Level patch(const Level& level, const LevelDiff& diff) {
+        std::unordered_map<std::string, std::string> headers = level.headers();
+        for (const std::string& k : diff.headersRemoved)
+            headers.erase(k);
+
+        for (auto const& [k, v] : diff.headersSet)
+            headers[k] = v;
+
+        std::vector<LevelObject> blocks(level.blocks().begin(), level.blocks().end());
+        deduplicate(blocks);
+
+        std::unordered_map<Coordinate3D, size_t> index;
+        index.reserve(blocks.size());
+        for (size_t i = 0; i < blocks.size(); i++)
+            index[blocks[i].coordinate3D()] = i;
+
+        std::vector<bool> removed(blocks.size());
+        for (const LevelObject& o : diff.removed) {
+            auto it = index.find(o.coordinate3D());
+            if (it != index.end()) removed[it->second] = true;
+        }
+
+        for (const BlockChange& c : diff.changed) {
+            auto it = index.find(c.after.coordinate3D());
+            if (it != index.end()) blocks[it->second] = c.after;
+        }
+
+        std::vector<LevelObject> result;
+        result.reserve(blocks.size() + diff.added.size());
+        for (size_t i = 0; i < blocks.size(); i++)
+            if (!removed[i]) result.push_back(std::move(blocks[i]));
+
+        for (const LevelObject& o : diff.added)
+            result.push_back(o);
+
+        if (headers.find("type") != headers.end() && headers.at("type") == "3")
+            return Level3D(headers, result);
+
+        return Level2D(headers, result);
+    }
+
+}
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <ostream>
+#include <sstream>
+#include <unordered_map>
+
+#include "coordinate.hpp"
+#include "block.hpp"
+#include "matrix.hpp"
+#include "writer.hpp"
+
+namespace LevelZ {
+
+    /**
+     * Options for generating a synthetic level.
+     */
+    struct GeneratorOptions {
+        /**
+         * Whether to generate a 2D level instead of a 3D level.
+         */
+        bool is2D = true;
+
+        /**
+         * The number of block lines to generate.
+         */
+        size_t lines = 1000;
+
+        /**
+         * The seed of the generator. The same options and seed always produce the same output.
+         */
+        uint64_t seed = 0;
+
+        /**
+         * The fraction of block lines that fill a coordinate matrix instead of listing points, from 0 to 1.
+         */
+        double matrixRatio = 0.1;
+
+        /**
+         * The number of points on each point line.
+         */
+        size_t pointsPerLine = 3;
+
+        /**
+         * The maximum size of a matrix along each axis.
+         */
+        int matrixSize = 8;
+
+        /**
+         * The coordinates are generated between -range and range on each axis.
+         */
+        int range = 1000;
+
+        /**
+         * The number of distinct block names.
+         */
+        size_t blockTypes = 8;
+
+        /**
+         * The number of properties on each block.
+         */
+        size_t properties = 1;
+
+        /**
+         * The number of distinct values of each property.
+         */
+        size_t propertyValues = 4;
+
+        /**
+         * The fraction of lines that are comments, from 0 to 1.
+         */
+        double commentDensity = 0.05;
+
+        /**
+         * Whether to write the end marker after the blocks.
+         */
+        bool endMarker = true;
+
+        /**
+         * The number of ignored lines to write after the end marker.
+         */
+        size_t trailingLines = 0;
+    };
+
+    /**
+     * Describes the output of the level generator.
+     */
+    struct GeneratorResult {
+        /**
+         * The number of lines written.
+         */
+        size_t lines = 0;
+
+        /**
+         * The number of bytes written.
+         */
+        size_t bytes = 0;
+
+        /**
+         * The number of blocks the level contains once parsed, including blocks at duplicate coordinates.
+         */
+        size_t blocks = 0;
+    };
+
+    /**
+     * Deterministic random number generator (SplitMix64), producing the same sequence on every platform.
+     */
+    struct SplitMix64 {
+        public:
+            /**
+             * The current state of the generator.
+             */
+            uint64_t state;
+
+            /**
+             * Constructs a new generator with the specified seed.
+             * @param seed The seed of the generator.
+             */
+            explicit SplitMix64(uint64_t seed) : state(seed) {}
+
+            /**
+             * Generates the next random number.
+             * @return A uniformly distributed 64-bit number.
+             */
+            uint64_t next() {
+                uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+                return z ^ (z >> 31);
+            }
+
+            /**
+             * Generates a random integer in a range.
+             * @param min The minimum value, inclusive.
+             * @param max The maximum value, inclusive.
+             * @return A random integer between min and max.
+             */
+            int range(int min, int max) {
+                uint64_t span = static_cast<uint64_t>(static_cast<int64_t>(max) - min + 1);
+                return static_cast<int>(min + static_cast<int64_t>(next() % span));
+            }
+
+            /**
+             * Generates a random number between 0 and 1.
+             * @return A random number in [0, 1).
+             */
+            double unit() {
+                return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0);
+            }
+    };
+
+    /**
+     * Generates a valid synthetic level, streaming it to the output.
+     * @param out The stream to write the level to.
+     * @param options The shape of the level to generate.
+     * @return The number of lines, bytes and blocks written.
+     */
+    inline GeneratorResult generate(std::ostream& out, const GeneratorOptions& options) {
+        SplitMix64 random(options.seed);
+        LevelWriter writer(out);
+        GeneratorResult result;
+
+        writer.header("type", options.is2D ? "2" : "3");
+        writer.header("spawn", options.is2D ? "[0, 0]" : "[0, 0, 0]");
+        if (options.is2D) writer.header("scroll", "none");
+        writer.endHeaders();
+
+        std::vector<Block> blocks;
+        for (size_t i = 0; i < std::max<size_t>(options.blockTypes, 1); i++) {
+            std::unordered_map<std::string, std::string> properties;
+            for (size_t p = 0; p < options.properties; p++)
+                properties["p" + std::to_string(p)] = std::to_string(random.next() % std::max<size_t>(options.propertyValues, 1));
+
+            blocks.push_back(Block("block" + std::to_string(i), properties));
+        }
+
+        std::vector<Coordinate2D> points2D;
+        std::vector<Coordinate3D> points3D;
+        const int range = options.range;
+        const int size = std::max(options.matrixSize, 1) - 1;
+
+        // values are drawn one statement at a time, since argument evaluation order is unspecified
+        auto coordinate = [&]() {
+            return random.range(-range, range);
+        };
+
+        auto point2D = [&]() {
+            double x = coordinate();
+            double y = coordinate();
+            return Coordinate2D(x, y);
+        };
+
+        auto point3D = [&]() {
+            double x = coordinate();
+            double y = coordinate();
+            double z = coordinate();
+            return Coordinate3D(x, y, z);
+        };
+
+        for (size_t line = 0; line < options.lines; line++) {
+            if (random.unit() < options.commentDensity)
+                writer.comment("Section " + std::to_string(line));
+
+            const Block& block = blocks[random.next() % blocks.size()];
+
+            if (random.unit() < options.matrixRatio) {
+                int x = random.range(0, size);
+                int y = random.range(0, size);
+
+                if (options.is2D) {
+                    CoordinateMatrix2D matrix(x, y, point2D());
+                    writer.matrix(block, matrix);
+                    result.blocks += matrix.size();
+                } else {
+                    int z = random.range(0, size);
+                    CoordinateMatrix3D matrix(x, y, z, point3D());
+                    writer.matrix(block, matrix);
+                    result.blocks += matrix.size();
+                }
+            } else if (options.is2D) {
+                points2D.clear();
+                for (size_t i = 0; i < std::max<size_t>(options.pointsPerLine, 1); i++)
+                    points2D.push_back(point2D());
+
+                writer.points(block, points2D);
+                result.blocks += points2D.size();
+            } else {
+                points3D.clear();
+                for (size_t i = 0; i < std::max<size_t>(options.pointsPerLine, 1); i++)
+                    points3D.push_back(point3D());
+
+                writer.points(block, points3D);
+                result.blocks += points3D.size();
+            }
+        }
+
+        if (options.endMarker) {
+            writer.end();
+
+            for (size_t i = 0; i < options.trailingLines; i++)
+                writer.comment("Trailing line " + std::to_string(i));
+        }
+
+        result.lines = writer.lines();
+        result.bytes = writer.bytes();
+        return result;
+    }
+
+    /**
+     * Generates a valid synthetic level as a string.
+     * @param options The shape of the level to generate.
+     * @return The contents of the level.
+     */
+    inline std::string generateContents(const GeneratorOptions& options) {
+        std::ostringstream out;
+        generate(out, options);
+        return out.str();
+    }
+
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "coordinate.hpp"
+
+namespace LevelZ {
+
+    /**
+     * Represents a scroll direction in a 2D level.
+     */
+    enum Scroll {
+        /**
+         * No Scrolling
+         */
+        NONE,
+        
+        /**
+         * Horizontal Scrolling moving left
+         */
+        HORIZONTAL_LEFT,
+
+        /**
+         * Horizontal Scrolling moving right
+         */
+        HORIZONTAL_RIGHT,
+
+        /**
+         * Vertical Scrolling moving up
+         */
+        VERTICAL_UP,
+
+        /**
+         * Vertical Scrolling moving down
+         */
+        VERTICAL_DOWN
+    };
+
+    /**
+     * The headers of a level in typed form, parsed once instead of looked up and compared as strings on each use.
+     */
+    struct LevelHeader {
+        public:
+            /**
+             * The number of dimensions of the level, 2 or 3.
+             */
+            int type = 2;
+
+            /**
+             * The spawnpoint of the level. The z coordinate is 0 in 2D levels.
+             */
+            Coordinate3D spawn = Coordinate3D(0.0, 0.0, 0.0);
+
+            /**
+             * The scroll direction of the level, which is always NONE in 3D levels.
+             */
+            Scroll scroll = Scroll::NONE;
+
+            /**
+             * The headers other than type, spawn and scroll, by key.
+             */
+            std::unordered_map<std::string, std::string> extra;
+
+            /**
+             * Gets whether the level is 2D.
+             * @return true if the level is 2D, false if it is 3D
+             */
+            inline bool is2D() const {
+                return type != 3;
+            }
+
+            /**
+             * Gets the spawnpoint of a 2D level.
+             * @return The x and y coordinates of the spawnpoint.
+             */
+            inline Coordinate2D spawn2D() const {
+                return Coordinate2D(spawn.x, spawn.y);
+            }
+
+            /**
+             * Parses the value of a scroll header.
+             * @param value The value of the header, such as "horizontal-left".
+             * @return The scroll direction, or NONE if the value is not a scroll direction.
+             */
+            static Scroll parseScroll(std::string_view value) {
+                if (value == "horizontal-left") return Scroll::HORIZONTAL_LEFT;
+                if (value == "horizontal-right") return Scroll::HORIZONTAL_RIGHT;
+                if (value == "vertical-up") return Scroll::VERTICAL_UP;
+                if (value == "vertical-down") return Scroll::VERTICAL_DOWN;
+
+                return Scroll::NONE;
+            }
+
+            /**
+             * Parses the headers of a level.
+             * @param headers The headers, by key.
+             * @return The typed headers.
+             * @throws std::invalid_argument if the spawn header is not a coordinate.
+             */
+            static LevelHeader parse(const std::unordered_map<std::string, std::string>& headers) {
+                LevelHeader header;
+
+                auto type = headers.find("type");
+                if (type != headers.end() && type->second == "3") header.type = 3;
+
+                for (auto const& [k, v] : headers) {
+                    if (k == "type") continue;
+
+                    if (k == "spawn") {
+                        if (header.is2D()) {
+                            Coordinate2D c = Coordinate2D::from_string(v);
+                            header.spawn = Coordinate3D(c.x, c.y, 0.0);
+                        } else
+                            header.spawn = Coordinate3D::from_string(v);
+                    } else if (k == "scroll") {
+                        if (header.is2D()) header.scroll = parseScroll(v);
+                    } else
+                        header.extra[k] = v;
+                }
+
+                return header;
+            }
+    };
+
+}
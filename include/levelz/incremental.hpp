@@ -0,0 +1,191 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+
+#include "../levelz.hpp"
+
+namespace LevelZ {
+
+    /**
+     * Represents a parsed level that can be edited line by line, re-parsing only the lines that change.
+     *
+     * Each source line is mapped to the range of blocks it produced in the level, so edits to the body
+     * are spliced into the existing blocks. Edits to the headers, or ones that add or remove the end marker,
+     * fall back to parsing the whole level again.
+     */
+    struct IncrementalLevel {
+        private:
+            std::vector<std::string> _lines;
+            std::vector<size_t> _counts;
+            size_t _headerEnd = 0;
+            size_t _end = 0;
+            bool _is2D = true;
+            Level _level;
+
+            void rebuild() {
+                _headerEnd = 0;
+                for (size_t i = 0; i < _lines.size(); i++)
+                    if (_lines[i] == HEADER_END) {
+                        _headerEnd = i;
+                        break;
+                    }
+
+                std::unordered_map<std::string, std::string> headers = readLevelHeaders(_lines.begin(), _lines.begin() + _headerEnd);
+                _is2D = headers.at("type") == "2";
+
+                _counts.assign(_lines.size(), 0);
+                _end = _lines.size();
+
+                BlockList blocks;
+                LevelStats stats;
+                for (size_t i = _headerEnd + 1; i < _lines.size(); i++) {
+                    size_t before = blocks.size();
+                    if (!readBodyLine(_lines[i], _is2D, blocks, nullptr, &stats)) {
+                        _end = i;
+                        break;
+                    }
+
+                    _counts[i] = blocks.size() - before;
+                }
+
+                _level = createLevel(headers, std::move(blocks), std::move(stats), false);
+            }
+
+            template <typename Target, typename Source>
+            static void splice(Target& target, size_t offset, size_t removed, Source& inserted) {
+                size_t common = std::min(removed, inserted.size());
+                std::move(inserted.begin(), inserted.begin() + common, target.begin() + offset);
+
+                if (inserted.size() > removed)
+                    target.insert(target.begin() + offset + common, std::make_move_iterator(inserted.begin() + common), std::make_move_iterator(inserted.end()));
+                else if (removed > inserted.size())
+                    target.erase(target.begin() + offset + common, target.begin() + offset + removed);
+            }
+
+        public:
+            /**
+             * Parses a level from the specified lines.
+             * @param lines The contents to read the level from.
+             */
+            explicit IncrementalLevel(const std::vector<std::string>& lines) : _lines(lines) {
+                rebuild();
+            }
+
+            /**
+             * Parses a level from the specified string.
+             * @param string The contents to read the level from.
+             * @return The parsed level.
+             */
+            static IncrementalLevel fromContents(const std::string& string) {
+                return IncrementalLevel(readContentLines(string));
+            }
+
+            /**
+             * Parses a level from the specified file.
+             * @param file The file to read the level from.
+             * @return The parsed level.
+             */
+            static IncrementalLevel fromFile(const std::string& file) {
+                return IncrementalLevel(readFileLines(file));
+            }
+
+            /**
+             * Gets the current level.
+             * @return The parsed level.
+             */
+            inline const Level& level() const {
+                return _level;
+            }
+
+            /**
+             * Gets the current source lines of the level.
+             * @return The source lines.
+             */
+            inline const std::vector<std::string>& lines() const {
+                return _lines;
+            }
+
+            /**
+             * Gets the range of blocks in level().blocks() produced by a source line.
+             * @param line The index of the source line.
+             * @return The offset of the first block and the number of blocks produced by the line.
+             */
+            std::pair<size_t, size_t> blockRange(size_t line) const {
+                size_t offset = 0;
+                for (size_t i = 0; i < line && i < _counts.size(); i++)
+                    offset += _counts[i];
+
+                return {offset, _counts.at(line)};
+            }
+
+            /**
+             * Replaces a range of source lines and updates the level.
+             * @param line The index of the first line to replace.
+             * @param removed The number of lines to remove.
+             * @param inserted The lines to insert in their place.
+             * @return true if only the edited lines were parsed, false if the whole level was parsed again
+             * @throws std::out_of_range if the edited range is outside of the source lines.
+             */
+            bool edit(size_t line, size_t removed, const std::vector<std::string>& inserted) {
+                if (line > _lines.size() || removed > _lines.size() - line)
+                    throw std::out_of_range("Edit outside of level source");
+
+                bool insertsEnd = false;
+                for (const std::string& l : inserted)
+                    if (l == END) insertsEnd = true;
+
+                bool afterEnd = _end < _lines.size() && line > _end;
+                bool full = line <= _headerEnd || (!afterEnd && (insertsEnd || (line <= _end && _end < line + removed)));
+
+                if (full) {
+                    _lines.erase(_lines.begin() + line, _lines.begin() + line + removed);
+                    _lines.insert(_lines.begin() + line, inserted.begin(), inserted.end());
+                    rebuild();
+                    return false;
+                }
+
+                std::vector<std::string> text = inserted;
+                std::vector<size_t> counts(inserted.size(), 0);
+
+                if (!afterEnd) {
+                    size_t offset = 0;
+                    for (size_t i = _headerEnd + 1; i < line; i++)
+                        offset += _counts[i];
+
+                    size_t old = 0;
+                    for (size_t i = line; i < line + removed; i++)
+                        old += _counts[i];
+
+                    std::vector<LevelObject> blocks;
+                    for (size_t i = 0; i < inserted.size(); i++) {
+                        size_t before = blocks.size();
+                        readBodyLine(inserted[i], _is2D, blocks);
+                        counts[i] = blocks.size() - before;
+                    }
+
+                    splice(_level._blocks, offset, old, blocks);
+                    _level.invalidate();
+                    _end = _end + inserted.size() - removed;
+                }
+
+                splice(_lines, line, removed, text);
+                splice(_counts, line, removed, counts);
+                return true;
+            }
+
+            /**
+             * Replaces a single source line and updates the level.
+             * @param line The index of the line to replace.
+             * @param text The new contents of the line.
+             * @return true if only the edited line was parsed, false if the whole level was parsed again
+             */
+            bool setLine(size_t line, const std::string& text) {
+                return edit(line, 1, {text});
+            }
+    };
+
+}
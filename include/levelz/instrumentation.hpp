@@ -0,0 +1,165 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace LevelZ {
+
+    /**
+     * Represents a stage of the parsing pipeline.
+     */
+    enum class ParseStage {
+        /**
+         * Reading the file or string into lines
+         */
+        READ,
+
+        /**
+         * Splitting the lines into the header and body sections
+         */
+        SPLIT,
+
+        /**
+         * Parsing the headers
+         */
+        HEADERS,
+
+        /**
+         * Parsing the blocks and points in the body, excluding matrices
+         */
+        BLOCKS,
+
+        /**
+         * Parsing and expanding coordinate matrices
+         */
+        MATRICES,
+
+        /**
+         * Constructing the level from the parsed headers and blocks
+         */
+        BUILD
+    };
+
+    /**
+     * Statistics about a single parse, filled in when passed through ParseOptions::stats.
+     */
+    struct ParseStats {
+        public:
+            /**
+             * The time spent reading the input into lines.
+             */
+            std::chrono::nanoseconds read{0};
+
+            /**
+             * The time spent splitting the header and body sections.
+             */
+            std::chrono::nanoseconds split{0};
+
+            /**
+             * The time spent parsing headers.
+             */
+            std::chrono::nanoseconds headers{0};
+
+            /**
+             * The time spent parsing blocks and points, excluding matrices.
+             */
+            std::chrono::nanoseconds blocks{0};
+
+            /**
+             * The time spent parsing and expanding coordinate matrices.
+             */
+            std::chrono::nanoseconds matrices{0};
+
+            /**
+             * The time spent constructing the level.
+             */
+            std::chrono::nanoseconds build{0};
+
+            /**
+             * The number of bytes processed, including line breaks.
+             */
+            size_t bytes = 0;
+
+            /**
+             * The number of lines processed.
+             */
+            size_t lines = 0;
+
+            /**
+             * The number of LevelObjects in the parsed level.
+             */
+            size_t objects = 0;
+
+            /**
+             * The number of coordinates expanded from matrices.
+             */
+            size_t matrixCoordinates = 0;
+
+            /**
+             * The largest size of the block vector during parsing, before deduplication.
+             */
+            size_t peakBlocks = 0;
+
+            /**
+             * The number of heap allocations made while parsing, as reported by ParseObserver::allocations.
+             * This is always 0 without an observer that tracks allocations.
+             */
+            size_t allocations = 0;
+
+            /**
+             * Gets the total time spent in all stages.
+             * @return The total time.
+             */
+            std::chrono::nanoseconds total() const {
+                return read + split + headers + blocks + matrices + build;
+            }
+
+            /**
+             * Gets the time spent in a stage.
+             * @param stage The stage.
+             * @return The time spent in the stage.
+             */
+            std::chrono::nanoseconds& operator[](ParseStage stage) {
+                switch (stage) {
+                    case ParseStage::READ: return read;
+                    case ParseStage::SPLIT: return split;
+                    case ParseStage::HEADERS: return headers;
+                    case ParseStage::BLOCKS: return blocks;
+                    case ParseStage::MATRICES: return matrices;
+                    default: return build;
+                }
+            }
+    };
+
+    /**
+     * Receives events from the parsing pipeline, when passed through ParseOptions::observer.
+     */
+    struct ParseObserver {
+        public:
+            virtual ~ParseObserver() = default;
+
+            /**
+             * Called when a stage of the pipeline finishes. MATRICES time is reported once, after the body is parsed.
+             * @param stage The stage that finished.
+             * @param duration The time spent in the stage.
+             */
+            virtual void onStage(ParseStage stage, std::chrono::nanoseconds duration) {}
+
+            /**
+             * Called when the parse completes.
+             * @param stats The statistics of the parse.
+             */
+            virtual void onComplete(const ParseStats& stats) {}
+
+            /**
+             * Gets the number of heap allocations made so far by the current thread or process.
+             *
+             * The library does not replace the global allocator; override this to report counts from the application's own allocator hooks.
+             * @return The allocation count.
+             */
+            virtual size_t allocations() {
+                return 0;
+            }
+    };
+
+}
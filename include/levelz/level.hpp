@@ -1,47 +1,182 @@
 #pragma once
 
 #include <vector>
+#include <memory>
+#include <cstdint>
+#include <memory_resource>
+#include <algorithm>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "block.hpp"
 #include "coordinate.hpp"
+#include "stats.hpp"
+#include "header.hpp"
 
 namespace LevelZ {
 
+    /**
+     * The storage of the blocks in a level, allocated from the memory resource the level was created with.
+     */
+    using BlockList = std::pmr::vector<LevelObject>;
+
     /**
      * Represents a LevelZ level.
+     *
+     * The blocks are stored in a BlockList, so a level parsed with ParseOptions::resource keeps its blocks in that resource,
+     * which must outlive the level. Copies of a level always use the default memory resource.
      */
     struct Level {
         protected:
             std::unordered_map<std::string, std::string> _headers = {};
-            std::vector<LevelZ::LevelObject> _blocks = {};
+            LevelHeader _header;
+            BlockList _blocks = {};
+
+            mutable size_t _fingerprint = 0;
+            mutable bool _fingerprinted = false;
+
+            mutable LevelStats _stats;
+            mutable bool _counted = false;
+
+            friend struct IncrementalLevel;
+            friend struct LevelBuilder;
+            friend void sortMorton(Level& level, size_t threads);
 
             Level() {}
 
+            /**
+             * Constructs a level that takes over the blocks and their memory resource.
+             * @param blocks The blocks of the level.
+             */
+            explicit Level(BlockList&& blocks) : _blocks(std::move(blocks)) {}
+
+            /**
+             * Discards the cached fingerprint. Must be called whenever the headers or blocks change.
+             */
+            void invalidate() {
+                _fingerprinted = false;
+                _counted = false;
+            }
+
+            /**
+             * Replaces the headers and parses their typed form once.
+             * @param headers The new headers.
+             * @param type The type to add if the headers do not have one, or nullptr to leave them unchanged.
+             */
+            void setHeaders(const std::unordered_map<std::string, std::string>& headers, const char* type = nullptr) {
+                _headers = headers;
+                if (type != nullptr && _headers.find("type") == _headers.end())
+                    _headers["type"] = type;
+
+                _header = LevelHeader::parse(_headers);
+            }
+
+            /**
+             * Adds a type header if the headers do not have one, parsing the typed headers again for the new type.
+             * @param type The type of level, "2" or "3".
+             */
+            void defaultType(const std::string& type) {
+                if (_headers.find("type") != _headers.end()) return;
+
+                _headers["type"] = type;
+                _header = LevelHeader::parse(_headers);
+            }
+
         public:
             /**
              * Gets the headers in the level.
              * @return The headers in the level.
              */
-            inline std::unordered_map<std::string, std::string> headers() const {
+            inline const std::unordered_map<std::string, std::string>& headers() const {
                 return _headers;
             }
 
+            /**
+             * Gets the typed form of the headers, parsed once when the headers were set.
+             * @return The typed headers of the level.
+             */
+            inline const LevelHeader& header() const {
+                return _header;
+            }
+
             /**
              * Gets the blocks in the level.
              * @return The blocks in the level.
              */
-            inline std::vector<LevelObject> blocks() const {
+            inline const BlockList& blocks() const {
                 return _blocks;
             }
 
             /**
-             * Compares two levels for equality.
+             * Gets the memory resource the blocks of the level are allocated from.
+             * @return The memory resource of the level.
+             */
+            inline std::pmr::memory_resource* resource() const {
+                return _blocks.get_allocator().resource();
+            }
+
+            /**
+             * Gets the bounding box, block counts and placement breakdown of the level.
+             *
+             * Parsed levels carry the statistics computed while parsing. Other levels compute them once on first use by scanning
+             * their blocks, counting every block as a point.
+             * @return The statistics of the level.
+             */
+            const LevelStats& stats() const {
+                if (!_counted) {
+                    _stats = LevelStats::of(_blocks);
+                    _counted = true;
+                }
+
+                return _stats;
+            }
+
+            /**
+             * Gets a hash of the level's contents, independent of header and block order.
+             * 
+             * The fingerprint is computed once and cached, so unchanged levels can be recognized in O(1) afterwards.
+             * Levels with different fingerprints are never equal; equal fingerprints are very likely, but not guaranteed, to be equal levels.
+             * @return The fingerprint of the level.
+             */
+            size_t fingerprint() const {
+                if (_fingerprinted) return _fingerprint;
+
+                std::hash<std::string> hs;
+                size_t headers = 0;
+                for (auto const& [k, v] : _headers)
+                    headers += mix(hash_combine(hs(k), hs(v)));
+
+                std::hash<LevelObject> ho;
+                size_t blocks = 0;
+                for (const LevelObject& o : _blocks)
+                    blocks += mix(ho(o));
+
+                _fingerprint = hash_combine(hash_combine(headers, blocks), _blocks.size());
+                _fingerprinted = true;
+                return _fingerprint;
+            }
+
+            /**
+             * Compares two levels for equality. Levels are equal if they have the same headers and the same blocks, in any order.
              * @param other The other level to compare.
              * @return true if the levels are equal, false if the levels are not equal
              */
             bool operator==(const Level& other) const {
-                return _headers == other._headers && _blocks == other._blocks;
+                if (_blocks.size() != other._blocks.size() || fingerprint() != other.fingerprint()) return false;
+                if (_headers != other._headers) return false;
+
+                std::unordered_map<LevelObject, size_t> counts;
+                counts.reserve(_blocks.size());
+                for (const LevelObject& o : _blocks)
+                    counts[o]++;
+
+                for (const LevelObject& o : other._blocks) {
+                    auto it = counts.find(o);
+                    if (it == counts.end() || it->second == 0) return false;
+                    it->second--;
+                }
+
+                return true;
             }
 
             /**
@@ -50,39 +185,51 @@ namespace LevelZ {
              * @return true if the levels are not equal, false if the levels are equal
              */
             bool operator!=(const Level& other) const {
-                return _headers != other._headers || _blocks != other._blocks;
+                return !(*this == other);
+            }
+
+        private:
+            static size_t mix(size_t h) {
+                // spreads the bits of each hash so that summing them does not cancel out similar values
+                uint64_t x = static_cast<uint64_t>(h);
+                x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ULL;
+                x ^= x >> 27; x *= 0x94d049bb133111ebULL;
+                x ^= x >> 31;
+                return static_cast<size_t>(x);
             }
     };
 
     /**
-     * Represents a scroll direction in a 2D level.
+     * Removes blocks that share a coordinate with a later block, so the last block placed at each coordinate wins.
+     * The remaining blocks keep their relative order.
+     * @param blocks The blocks to deduplicate, in a std::vector or BlockList.
+     * @return The number of blocks removed.
      */
-    enum Scroll {
-        /**
-         * No Scrolling
-         */
-        NONE,
-        
-        /**
-         * Horizontal Scrolling moving left
-         */
-        HORIZONTAL_LEFT,
-
-        /**
-         * Horizontal Scrolling moving right
-         */
-        HORIZONTAL_RIGHT,
-
-        /**
-         * Vertical Scrolling moving up
-         */
-        VERTICAL_UP,
-
-        /**
-         * Vertical Scrolling moving down
-         */
-        VERTICAL_DOWN
-    };
+    template <typename Blocks>
+    inline size_t deduplicate(Blocks& blocks) {
+        std::unordered_set<Coordinate3D> seen;
+        seen.reserve(blocks.size());
+
+        std::vector<bool> keep(blocks.size());
+        size_t kept = 0;
+        for (size_t i = blocks.size(); i-- > 0;) {
+            keep[i] = seen.insert(blocks[i].coordinate3D()).second;
+            if (keep[i]) kept++;
+        }
+
+        if (kept == blocks.size()) return 0;
+
+        size_t j = 0;
+        for (size_t i = 0; i < blocks.size(); i++)
+            if (keep[i]) {
+                if (i != j) blocks[j] = std::move(blocks[i]);
+                j++;
+            }
+
+        size_t removed = blocks.size() - kept;
+        blocks.erase(blocks.begin() + kept, blocks.end());
+        return removed;
+    }
 
     /**
      * Represents a 2D Level.
@@ -111,41 +258,39 @@ namespace LevelZ {
              * @param blocks The blocks of the level.
              */
             Level2D(const std::unordered_map<std::string, std::string>& headers, const std::vector<LevelObject>& blocks) {
-                _headers = headers;
-                _blocks = blocks;
-
-                if (headers.find("type") == headers.end())
-                    _headers["type"] = "2";
-
-                spawn = Coordinate2D(0, 0);
-                if (headers.find("spawn") != headers.end()) {
-                    spawn = Coordinate2D::from_string(headers.at("spawn"));
-                }
+                setHeaders(headers, "2");
+                _blocks.assign(blocks.begin(), blocks.end());
+                spawn = _header.spawn2D();
             }
 
             /**
              * Clones a 2D Level from an Abstract Level.
              * @param level The level to clone.
              */
-            explicit Level2D(const Level& level) : Level2D(level.headers(), level.blocks()) {};
+            explicit Level2D(const Level& level) : Level(level) {
+                init();
+            }
+
+            /**
+             * Converts an Abstract Level into a 2D Level, taking over its blocks.
+             * @param level The level to convert.
+             */
+            explicit Level2D(Level&& level) : Level(std::move(level)) {
+                init();
+            }
 
             /**
              * Gets the scroll direction of the level.
              * @return Scroll Direction
              */
-            inline Scroll scroll() {
-                if (_headers.find("scroll") == _headers.end())
-                    return Scroll::NONE;
-
-                std::string scroll = _headers.at("scroll");
-
-                if (scroll == "none") return Scroll::NONE;
-                if (scroll == "horizontal-left") return Scroll::HORIZONTAL_LEFT;
-                if (scroll == "horizontal-right") return Scroll::HORIZONTAL_RIGHT;
-                if (scroll == "vertical-up") return Scroll::VERTICAL_UP;
-                if (scroll == "vertical-down") return Scroll::VERTICAL_DOWN;
+            inline Scroll scroll() const {
+                return _header.scroll;
+            }
 
-                return Scroll::NONE;
+        private:
+            void init() {
+                defaultType("2");
+                spawn = _header.spawn2D();
             }
     };
 
@@ -176,23 +321,45 @@ namespace LevelZ {
              * @param blocks The blocks of the level.
              */
             Level3D(const std::unordered_map<std::string, std::string>& headers, const std::vector<LevelObject>& blocks) {
-                _headers = headers;
-                _blocks = blocks;
-
-                if (headers.find("type") == headers.end())
-                    _headers["type"] = "3";
-
-                spawn = Coordinate3D(0, 0, 0);
-                if (headers.find("spawn") != headers.end()) {
-                    spawn = Coordinate3D::from_string(headers.at("spawn"));
-                }
+                setHeaders(headers, "3");
+                _blocks.assign(blocks.begin(), blocks.end());
+                spawn = _header.spawn;
             }
 
             /**
              * Clones a 3D Level from an Abstract Level.
              * @param level The level to clone.
              */
-            explicit Level3D(const Level& level) : Level3D(level.headers(), level.blocks()) {};
+            explicit Level3D(const Level& level) : Level(level) {
+                init();
+            }
+
+            /**
+             * Converts an Abstract Level into a 3D Level, taking over its blocks.
+             * @param level The level to convert.
+             */
+            explicit Level3D(Level&& level) : Level(std::move(level)) {
+                init();
+            }
+
+        private:
+            void init() {
+                defaultType("3");
+                spawn = _header.spawn;
+            }
     };
 
+    /**
+     * Moves a level into an immutable, shared Level2D or Level3D, depending on its type header.
+     * @param level The level to share.
+     * @return The shared level.
+     */
+    inline std::shared_ptr<const Level> share(Level&& level) {
+        auto type = level.headers().find("type");
+        if (type != level.headers().end() && type->second == "3")
+            return std::make_shared<const Level3D>(std::move(level));
+
+        return std::make_shared<const Level2D>(std::move(level));
+    }
+
 }
\ No newline at end of file
@@ -0,0 +1,342 @@
+#pragma once
+
+#include <cmath>
+#include <array>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "coordinate.hpp"
+#include "block.hpp"
+#include "matrix.hpp"
+#include "level.hpp"
+#include "world.hpp"
+
+namespace LevelZ {
+
+    /**
+     * A pyramid of downsampled copies of a world, for answering coarse questions about large regions without visiting their blocks.
+     *
+     * Level 0 is the world itself, with one block per unit cell. Each cell of level k covers 2^k cells of level 0 along each
+     * axis and records how many blocks it contains and which block is the most common among them, so asking whether an aligned
+     * region of 2^k cells is empty is a single lookup. Only cells containing blocks are stored. 2D levels lie in the z = 0 plane.
+     *
+     * Building the pyramid splits the sections of the world between threads, and editing a cell updates one cell per level.
+     */
+    struct LevelPyramid {
+        private:
+            struct Node {
+                uint64_t count = 0;
+
+                // the number of blocks with each block id, usually only a few
+                std::vector<std::pair<uint32_t, uint64_t>> blocks;
+
+                void add(uint32_t id, int64_t count) {
+                    this->count = static_cast<uint64_t>(static_cast<int64_t>(this->count) + count);
+
+                    for (size_t i = 0; i < blocks.size(); i++)
+                        if (blocks[i].first == id) {
+                            blocks[i].second = static_cast<uint64_t>(static_cast<int64_t>(blocks[i].second) + count);
+                            if (blocks[i].second == 0) blocks.erase(blocks.begin() + i);
+                            return;
+                        }
+
+                    blocks.push_back({id, static_cast<uint64_t>(count)});
+                }
+
+                void add(const Node& other) {
+                    for (auto const& [id, count] : other.blocks)
+                        add(id, static_cast<int64_t>(count));
+                }
+
+                uint32_t dominant() const {
+                    std::pair<uint32_t, uint64_t> best = {0, 0};
+                    for (auto const& [id, count] : blocks)
+                        if (count > best.second || (count == best.second && id < best.first)) best = {id, count};
+
+                    return best.first;
+                }
+            };
+
+            using Cells = std::unordered_map<uint64_t, Node>;
+            static constexpr int SIZE = ChunkedWorld3D::SECTION_SIZE;
+
+            ChunkedWorld3D _world;
+            std::vector<Cells> _levels;
+
+            static uint64_t key(int x, int y, int z) {
+                return (static_cast<uint64_t>(x & 0x1FFFFF) << 42) | (static_cast<uint64_t>(y & 0x1FFFFF) << 21) | static_cast<uint64_t>(z & 0x1FFFFF);
+            }
+
+            // divides by 2^k, rounding down
+            static int shift(int value, int k) {
+                return value >= 0 ? value >> k : ~((~value) >> k);
+            }
+
+            static int toCell(double value) {
+                return static_cast<int>(std::floor(value));
+            }
+
+            const Node* node(int level, int x, int y, int z) const {
+                const Cells& cells = _levels[static_cast<size_t>(level) - 1];
+                auto it = cells.find(key(x, y, z));
+                return it == cells.end() ? nullptr : &it->second;
+            }
+
+            void check(int level) const {
+                if (level < 0 || level > levels()) throw std::out_of_range("Pyramid level " + std::to_string(level) + " out of range");
+            }
+
+            // the levels up to a section, computed from one section of the world at a time
+            void build(size_t threads) {
+                const std::vector<std::array<int, 3>> chunks = _world.chunks();
+                const int local = std::min(levels(), 4);
+
+                if (threads == 0) threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+                threads = std::max<size_t>(1, std::min(threads, chunks.size()));
+
+                std::vector<std::vector<Cells>> results(threads, std::vector<Cells>(static_cast<size_t>(local)));
+                auto task = [&](size_t t) {
+                    std::vector<std::vector<Node>> grids(static_cast<size_t>(local) + 1);
+
+                    for (size_t c = t; c < chunks.size(); c += threads) {
+                        const int bx = chunks[c][0] * SIZE, by = chunks[c][1] * SIZE, bz = chunks[c][2] * SIZE;
+
+                        grids[0].assign(static_cast<size_t>(SIZE) * SIZE * SIZE, Node());
+                        for (int y = 0; y < SIZE; y++)
+                            for (int z = 0; z < SIZE; z++)
+                                for (int x = 0; x < SIZE; x++) {
+                                    uint32_t id = _world.blockId(bx + x, by + y, bz + z);
+                                    if (id != 0) grids[0][(static_cast<size_t>(y) * SIZE + z) * SIZE + x].add(id, 1);
+                                }
+
+                        for (int k = 1; k <= local; k++) {
+                            const int size = SIZE >> k;
+                            grids[k].assign(static_cast<size_t>(size) * size * size, Node());
+
+                            for (int y = 0; y < size * 2; y++)
+                                for (int z = 0; z < size * 2; z++)
+                                    for (int x = 0; x < size * 2; x++) {
+                                        const Node& child = grids[k - 1][(static_cast<size_t>(y) * size * 2 + z) * size * 2 + x];
+                                        if (child.count != 0) grids[k][(static_cast<size_t>(y / 2) * size + z / 2) * size + x / 2].add(child);
+                                    }
+
+                            for (int y = 0; y < size; y++)
+                                for (int z = 0; z < size; z++)
+                                    for (int x = 0; x < size; x++) {
+                                        const Node& n = grids[k][(static_cast<size_t>(y) * size + z) * size + x];
+                                        if (n.count != 0) results[t][k - 1].emplace(key(shift(bx, k) + x, shift(by, k) + y, shift(bz, k) + z), n);
+                                    }
+                        }
+                    }
+                };
+
+                std::vector<std::thread> pool;
+                for (size_t t = 1; t < threads; t++)
+                    pool.emplace_back(task, t);
+
+                task(0);
+                for (std::thread& thread : pool) thread.join();
+
+                // sections never share a cell below their own size, so their cells are merged without combining
+                for (int k = 0; k < local; k++)
+                    for (std::vector<Cells>& result : results)
+                        _levels[k].merge(result[k]);
+
+                for (int k = local; k < levels(); k++)
+                    for (auto const& [id, n] : _levels[k - 1]) {
+                        const int x = static_cast<int>(id >> 42), y = static_cast<int>((id >> 21) & 0x1FFFFF), z = static_cast<int>(id & 0x1FFFFF);
+
+                        // restores the sign of each 21-bit coordinate before halving it
+                        auto sign = [](int v) { return v & 0x100000 ? v - 0x200000 : v; };
+                        _levels[k][key(shift(sign(x), 1), shift(sign(y), 1), shift(sign(z), 1))].add(n);
+                    }
+            }
+
+            bool empty(int level, int x0, int y0, int z0, int x1, int y1, int z1) const {
+                for (int x = shift(x0, level); x <= shift(x1, level); x++)
+                    for (int y = shift(y0, level); y <= shift(y1, level); y++)
+                        for (int z = shift(z0, level); z <= shift(z1, level); z++) {
+                            if (count(level, x, y, z) == 0) continue;
+
+                            // a cell with blocks that lies inside the region settles it, others are split into their children
+                            const int size = 1 << level;
+                            if (x * size >= x0 && (x + 1) * size - 1 <= x1 && y * size >= y0 && (y + 1) * size - 1 <= y1 && z * size >= z0 && (z + 1) * size - 1 <= z1) return false;
+
+                            const int cx0 = std::max(x0, x * size), cx1 = std::min(x1, (x + 1) * size - 1);
+                            const int cy0 = std::max(y0, y * size), cy1 = std::min(y1, (y + 1) * size - 1);
+                            const int cz0 = std::max(z0, z * size), cz1 = std::min(z1, (z + 1) * size - 1);
+                            if (!empty(level - 1, cx0, cy0, cz0, cx1, cy1, cz1)) return false;
+                        }
+
+                return true;
+            }
+
+        public:
+            /**
+             * Constructs a pyramid from the blocks of a level. Later blocks replace earlier blocks in the same cell.
+             * @param level The level to read the blocks from.
+             * @param levels The number of downsampled levels to build above the blocks.
+             * @param threads The number of threads to build with, or 0 for the number of hardware threads.
+             * @throws std::invalid_argument if the number of levels is not between 1 and 20.
+             */
+            explicit LevelPyramid(const Level& level, int levels = 8, size_t threads = 0) : LevelPyramid(ChunkedWorld3D(level), levels, threads) {}
+
+            /**
+             * Constructs a pyramid from a world.
+             * @param world The world to read the blocks from.
+             * @param levels The number of downsampled levels to build above the blocks.
+             * @param threads The number of threads to build with, or 0 for the number of hardware threads.
+             * @throws std::invalid_argument if the number of levels is not between 1 and 20.
+             */
+            explicit LevelPyramid(ChunkedWorld3D world, int levels = 8, size_t threads = 0) : _world(std::move(world)) {
+                if (levels < 1 || levels > 20) throw std::invalid_argument("Pyramid must have between 1 and 20 levels");
+
+                _levels.resize(static_cast<size_t>(levels));
+                build(threads);
+            }
+
+            /**
+             * Gets the world at the bottom of the pyramid.
+             * @return The world of the pyramid.
+             */
+            inline const ChunkedWorld3D& world() const {
+                return _world;
+            }
+
+            /**
+             * Gets the number of downsampled levels above the blocks.
+             * @return The number of levels.
+             */
+            inline int levels() const {
+                return static_cast<int>(_levels.size());
+            }
+
+            /**
+             * Gets the number of cells containing blocks in a level.
+             * @param level The level, where 0 is the blocks themselves.
+             * @return The number of non-empty cells.
+             * @throws std::out_of_range if the level does not exist.
+             */
+            size_t cells(int level) const {
+                check(level);
+                return level == 0 ? _world.size() : _levels[static_cast<size_t>(level) - 1].size();
+            }
+
+            /**
+             * Gets the number of blocks in a cell of a level.
+             * @param level The level, where 0 is the blocks themselves.
+             * @param x The x coordinate of the cell, in units of 2^level blocks.
+             * @param y The y coordinate of the cell, in units of 2^level blocks.
+             * @param z The z coordinate of the cell, in units of 2^level blocks.
+             * @return The number of blocks in the cell.
+             * @throws std::out_of_range if the level does not exist.
+             */
+            uint64_t count(int level, int x, int y, int z) const {
+                check(level);
+                if (level == 0) return _world.blockId(x, y, z) != 0 ? 1 : 0;
+
+                const Node* n = node(level, x, y, z);
+                return n == nullptr ? 0 : n->count;
+            }
+
+            /**
+             * Gets whether a cell of a level contains no blocks.
+             * @param level The level, where 0 is the blocks themselves.
+             * @param x The x coordinate of the cell, in units of 2^level blocks.
+             * @param y The y coordinate of the cell, in units of 2^level blocks.
+             * @param z The z coordinate of the cell, in units of 2^level blocks.
+             * @return true if the cell is empty, false otherwise
+             * @throws std::out_of_range if the level does not exist.
+             */
+            bool empty(int level, int x, int y, int z) const {
+                return count(level, x, y, z) == 0;
+            }
+
+            /**
+             * Gets the most common block in a cell of a level. Ties go to the block placed in the world first.
+             * @param level The level, where 0 is the blocks themselves.
+             * @param x The x coordinate of the cell, in units of 2^level blocks.
+             * @param y The y coordinate of the cell, in units of 2^level blocks.
+             * @param z The z coordinate of the cell, in units of 2^level blocks.
+             * @return The most common block, or nullptr if the cell is empty.
+             * @throws std::out_of_range if the level does not exist.
+             */
+            const Block* dominant(int level, int x, int y, int z) const {
+                check(level);
+                if (level == 0) return _world.get(x, y, z);
+
+                const Node* n = node(level, x, y, z);
+                return n == nullptr ? nullptr : &_world.palette()[n->dominant() - 1];
+            }
+
+            /**
+             * Checks whether a region of cells contains no blocks, descending the pyramid only into cells that partly overlap it.
+             * @param region The cells to check.
+             * @return true if no cell in the region contains a block, false otherwise
+             */
+            bool empty(const CoordinateMatrix3D& region) const {
+                if (region.size() == 0) return true;
+
+                const int x0 = toCell(region.start.x) + region.minX, x1 = toCell(region.start.x) + region.maxX;
+                const int y0 = toCell(region.start.y) + region.minY, y1 = toCell(region.start.y) + region.maxY;
+                const int z0 = toCell(region.start.z) + region.minZ, z1 = toCell(region.start.z) + region.maxZ;
+
+                // starts at the finest level whose cells cover the region with a few cells along each axis
+                int level = 0;
+                const int extent = std::max({x1 - x0, y1 - y0, z1 - z0});
+                while (level < levels() && (extent >> level) > 1) level++;
+
+                return empty(level, x0, y0, z0, x1, y1, z1);
+            }
+
+            /**
+             * Places a block in a cell, updating the cell containing it in every level.
+             * @param x The x coordinate of the cell.
+             * @param y The y coordinate of the cell.
+             * @param z The z coordinate of the cell.
+             * @param block The block to place.
+             */
+            void set(int x, int y, int z, const Block& block) {
+                const uint32_t before = _world.blockId(x, y, z);
+                _world.set(x, y, z, block);
+                const uint32_t after = _world.blockId(x, y, z);
+                if (before == after) return;
+
+                for (int k = 1; k <= levels(); k++) {
+                    Node& n = _levels[static_cast<size_t>(k) - 1][key(shift(x, k), shift(y, k), shift(z, k))];
+                    if (before != 0) n.add(before, -1);
+                    n.add(after, 1);
+                }
+            }
+
+            /**
+             * Empties a cell, updating the cell containing it in every level.
+             * @param x The x coordinate of the cell.
+             * @param y The y coordinate of the cell.
+             * @param z The z coordinate of the cell.
+             * @return true if the cell contained a block, false otherwise
+             */
+            bool erase(int x, int y, int z) {
+                const uint32_t before = _world.blockId(x, y, z);
+                if (before == 0) return false;
+
+                _world.erase(x, y, z);
+                for (int k = 1; k <= levels(); k++) {
+                    Cells& cells = _levels[static_cast<size_t>(k) - 1];
+                    auto it = cells.find(key(shift(x, k), shift(y, k), shift(z, k)));
+
+                    it->second.add(before, -1);
+                    if (it->second.count == 0) cells.erase(it);
+                }
+
+                return true;
+            }
+    };
+
+}
@@ -2,7 +2,9 @@
 
 #include <vector>
 #include <array>
-#include <regex>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
 
 #include "coordinate.hpp"
 
@@ -19,6 +21,31 @@ namespace LevelZ {
         virtual std::string to_string() const = 0;
     };
 
+    /**
+     * Parses the bounds of a coordinate matrix, such as "(0, 1, 2, 3)", usable in constant expressions.
+     * @tparam N The number of bounds.
+     * @param str The string to parse.
+     * @return The bounds, in order.
+     * @throws std::invalid_argument if the string does not hold N bounds.
+     */
+    template <size_t N>
+    constexpr std::array<int, N> parseMatrixBounds(std::string_view str) {
+        str = trimView(str);
+        if (str.size() < 2 || str.front() != '(' || str.back() != ')') throw std::invalid_argument("Invalid coordinate matrix bounds");
+
+        str = str.substr(1, str.size() - 2);
+        std::array<int, N> bounds = {};
+        for (size_t i = 0; i < N; i++) {
+            size_t comma = i + 1 < N ? str.find(',') : str.size();
+            if (comma == std::string_view::npos) throw std::invalid_argument("Invalid coordinate matrix bounds");
+
+            bounds[i] = static_cast<int>(parseNumber(str.substr(0, comma)));
+            str = str.substr(comma < str.size() ? comma + 1 : str.size());
+        }
+
+        return bounds;
+    }
+
     /**
      * Represents a 2D matrix of coordinates.
      */
@@ -55,7 +82,7 @@ namespace LevelZ {
              * @param y The maximum y coordinate of the matrix.
              * @param start The starting coordinate of the matrix.
              */
-            CoordinateMatrix2D(int x, int y, LevelZ::Coordinate2D start) : minX(0), maxX(x), minY(0), maxY(y), start(start) {}
+            constexpr CoordinateMatrix2D(int x, int y, LevelZ::Coordinate2D start) : minX(0), maxX(x), minY(0), maxY(y), start(start) {}
 
             /**
              * Constructs a new CoordinateMatrix2D object with the specified minimum and maximum coordinates.
@@ -65,7 +92,7 @@ namespace LevelZ {
              * @param maxY The maximum y coordinate of the matrix.
              * @param start The starting coordinate of the matrix.
              */
-            CoordinateMatrix2D(int minX, int maxX, int minY, int maxY, LevelZ::Coordinate2D start) : minX(minX), maxX(maxX), minY(minY), maxY(maxY), start(start) {}
+            constexpr CoordinateMatrix2D(int minX, int maxX, int minY, int maxY, LevelZ::Coordinate2D start) : minX(minX), maxX(maxX), minY(minY), maxY(maxY), start(start) {}
 
             /**
              * Gets the coordinates in the matrix.
@@ -73,20 +100,79 @@ namespace LevelZ {
              */
             std::vector<LevelZ::Coordinate2D> getCoordinates() const {
                 std::vector<LevelZ::Coordinate2D> coordinates;
+                coordinates.reserve(size());
                 for (int x = minX; x <= maxX; x++) {
                     for (int y = minY; y <= maxY; y++) {
-                        coordinates.push_back(LevelZ::Coordinate2D(x, y));
+                        coordinates.push_back(LevelZ::Coordinate2D(start.x + x, start.y + y));
                     }
                 }
                 return coordinates;
             }
 
-            std::vector<LevelZ::Coordinate2D>::const_iterator begin() const {
-                return getCoordinates().begin();
+            /**
+             * Gets the number of coordinates in the matrix.
+             * @return The number of coordinates in the matrix.
+             */
+            constexpr size_t size() const {
+                if (maxX < minX || maxY < minY) return 0;
+                return static_cast<size_t>(maxX - minX + 1) * static_cast<size_t>(maxY - minY + 1);
             }
 
-            std::vector<LevelZ::Coordinate2D>::const_iterator end() const {
-                return getCoordinates().end();
+            /**
+             * Iterates over the coordinates in the matrix without storing them.
+             */
+            struct iterator {
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = LevelZ::Coordinate2D;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const LevelZ::Coordinate2D*;
+                using reference = LevelZ::Coordinate2D;
+
+                const CoordinateMatrix2D* matrix;
+                int x;
+                int y;
+
+                LevelZ::Coordinate2D operator*() const {
+                    return LevelZ::Coordinate2D(matrix->start.x + x, matrix->start.y + y);
+                }
+
+                iterator& operator++() {
+                    if (++y > matrix->maxY) {
+                        y = matrix->minY;
+                        x++;
+                    }
+                    return *this;
+                }
+
+                iterator operator++(int) {
+                    iterator it = *this;
+                    ++*this;
+                    return it;
+                }
+
+                bool operator==(const iterator& other) const {
+                    return x == other.x && y == other.y;
+                }
+
+                bool operator!=(const iterator& other) const {
+                    return x != other.x || y != other.y;
+                }
+            };
+
+            /**
+             * Gets an iterator to the first coordinate in the matrix.
+             * @return The iterator.
+             */
+            iterator begin() const {
+                return size() == 0 ? end() : iterator{this, minX, minY};
+            }
+
+            /**
+             * Gets an iterator past the last coordinate in the matrix.
+             * @return The iterator.
+             */
+            iterator end() const {
+                return iterator{this, maxX + 1, minY};
             }
 
             /**
@@ -121,33 +207,21 @@ namespace LevelZ {
              * @return The 2D coordinate matrix. 
              */
             static LevelZ::CoordinateMatrix2D from_string(const std::string& str) {
-                const std::regex matrix("[\\[\\]()]");
-                std::string s0 = std::regex_replace(str, matrix, "");
-                s0 = s0.replace(s0.find('^'), 1, ", ");
-
-                unsigned int i = 0;
-                size_t cpos = 0;
-                std::string s1;
-
-                int x1, x2, y1, y2;
-                double cx, cy;
-
-                while ((cpos = s0.find(',')) != std::string::npos) {
-                    s1 = s0.substr(0, cpos);
-                    switch (i) {
-                        case 0: x1 = std::stoi(s1); break;
-                        case 1: x2 = std::stoi(s1); break;
-                        case 2: y1 = std::stoi(s1); break;
-                        case 3: y2 = std::stoi(s1); break;
-                        case 4: cx = std::stod(s1); break;
-                    }
-                    
-                    s0.erase(0, cpos + 1);
-                    i++;
-                }
-                cy = std::stod(s0);
+                return parse(str);
+            }
 
-                return CoordinateMatrix2D(x1, x2, y1, y2, LevelZ::Coordinate2D(cx, cy));
+            /**
+             * Parses a 2D coordinate matrix such as "(0, 1, 0, 1)^[2, 2]", usable in constant expressions.
+             * @param str The string to parse.
+             * @return The parsed coordinate matrix.
+             * @throws std::invalid_argument if the string is not a 2D coordinate matrix.
+             */
+            static constexpr LevelZ::CoordinateMatrix2D parse(std::string_view str) {
+                size_t caret = str.find('^');
+                if (caret == std::string_view::npos) throw std::invalid_argument("Invalid 2D coordinate matrix");
+
+                std::array<int, 4> b = parseMatrixBounds<4>(str.substr(0, caret));
+                return CoordinateMatrix2D(b[0], b[1], b[2], b[3], LevelZ::Coordinate2D::parse(str.substr(caret + 1)));
             }
     };
 
@@ -198,7 +272,7 @@ namespace LevelZ {
              * @param z The maximum z coordinate of the matrix.
              * @param start The starting coordinate of the matrix.
              */
-            CoordinateMatrix3D(int x, int y, int z, LevelZ::Coordinate3D start) : minX(0), maxX(x), minY(0), maxY(y), minZ(0), maxZ(z), start(start) {}
+            constexpr CoordinateMatrix3D(int x, int y, int z, LevelZ::Coordinate3D start) : minX(0), maxX(x), minY(0), maxY(y), minZ(0), maxZ(z), start(start) {}
 
             /**
              * Constructs a new CoordinateMatrix3D object with the specified minimum and maximum coordinates.
@@ -210,7 +284,7 @@ namespace LevelZ {
              * @param maxZ The maximum z coordinate of the matrix.
              * @param start The starting coordinate of the matrix.
              */
-            CoordinateMatrix3D(int minX, int maxX, int minY, int maxY, int minZ, int maxZ, LevelZ::Coordinate3D start) : minX(minX), maxX(maxX), minY(minY), maxY(maxY), minZ(minZ), maxZ(maxZ), start(start) {}
+            constexpr CoordinateMatrix3D(int minX, int maxX, int minY, int maxY, int minZ, int maxZ, LevelZ::Coordinate3D start) : minX(minX), maxX(maxX), minY(minY), maxY(maxY), minZ(minZ), maxZ(maxZ), start(start) {}
 
             /**
              * Gets the coordinates in the matrix.
@@ -218,22 +292,85 @@ namespace LevelZ {
              */
             std::vector<LevelZ::Coordinate3D> getCoordinates() const {
                 std::vector<LevelZ::Coordinate3D> coordinates;
+                coordinates.reserve(size());
                 for (int x = minX; x <= maxX; x++) {
                     for (int y = minY; y <= maxY; y++) {
                         for (int z = minZ; z <= maxZ; z++) {
-                            coordinates.push_back(LevelZ::Coordinate3D(x, y, z));
+                            coordinates.push_back(LevelZ::Coordinate3D(start.x + x, start.y + y, start.z + z));
                         }
                     }
                 }
                 return coordinates;
             }
 
-            std::vector<LevelZ::Coordinate3D>::const_iterator begin() const {
-                return getCoordinates().begin();
+            /**
+             * Gets the number of coordinates in the matrix.
+             * @return The number of coordinates in the matrix.
+             */
+            constexpr size_t size() const {
+                if (maxX < minX || maxY < minY || maxZ < minZ) return 0;
+                return static_cast<size_t>(maxX - minX + 1) * static_cast<size_t>(maxY - minY + 1) * static_cast<size_t>(maxZ - minZ + 1);
+            }
+
+            /**
+             * Iterates over the coordinates in the matrix without storing them.
+             */
+            struct iterator {
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = LevelZ::Coordinate3D;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const LevelZ::Coordinate3D*;
+                using reference = LevelZ::Coordinate3D;
+
+                const CoordinateMatrix3D* matrix;
+                int x;
+                int y;
+                int z;
+
+                LevelZ::Coordinate3D operator*() const {
+                    return LevelZ::Coordinate3D(matrix->start.x + x, matrix->start.y + y, matrix->start.z + z);
+                }
+
+                iterator& operator++() {
+                    if (++z > matrix->maxZ) {
+                        z = matrix->minZ;
+                        if (++y > matrix->maxY) {
+                            y = matrix->minY;
+                            x++;
+                        }
+                    }
+                    return *this;
+                }
+
+                iterator operator++(int) {
+                    iterator it = *this;
+                    ++*this;
+                    return it;
+                }
+
+                bool operator==(const iterator& other) const {
+                    return x == other.x && y == other.y && z == other.z;
+                }
+
+                bool operator!=(const iterator& other) const {
+                    return x != other.x || y != other.y || z != other.z;
+                }
+            };
+
+            /**
+             * Gets an iterator to the first coordinate in the matrix.
+             * @return The iterator.
+             */
+            iterator begin() const {
+                return size() == 0 ? end() : iterator{this, minX, minY, minZ};
             }
 
-            std::vector<LevelZ::Coordinate3D>::const_iterator end() const {
-                return getCoordinates().end();
+            /**
+             * Gets an iterator past the last coordinate in the matrix.
+             * @return The iterator.
+             */
+            iterator end() const {
+                return iterator{this, maxX + 1, minY, minZ};
             }
 
             /**
@@ -251,7 +388,7 @@ namespace LevelZ {
              * @return true if the coordinate matrices are not equal, false otherwise.
              */
             bool operator!=(const CoordinateMatrix3D& other) const {
-                return minX != other.minX || maxX != other.maxX || minY != other.minY || maxY != other.maxY || minZ != other.minZ || maxZ != other.maxZ || start == other.start;
+                return minX != other.minX || maxX != other.maxX || minY != other.minY || maxY != other.maxY || minZ != other.minZ || maxZ != other.maxZ || start != other.start;
             }
 
             /**
@@ -268,36 +405,21 @@ namespace LevelZ {
              * @return The 3D coordinate matrix. 
              */
             static LevelZ::CoordinateMatrix3D from_string(const std::string& str) {
-                const std::regex matrix("[\\[\\]()]");
-                std::string s0 = std::regex_replace(str, matrix, "");
-                s0 = s0.replace(s0.find('^'), 1, ", ");
-
-                unsigned int i = 0;
-                size_t cpos = 0;
-                std::string s1;
-
-                int x1, x2, y1, y2, z1, z2;
-                double cx, cy, cz;
-
-                while ((cpos = s0.find(',')) != std::string::npos) {
-                    s1 = s0.substr(0, cpos);
-                    switch (i) {
-                        case 0: x1 = std::stoi(s1); break;
-                        case 1: x2 = std::stoi(s1); break;
-                        case 2: y1 = std::stoi(s1); break;
-                        case 3: y2 = std::stoi(s1); break;
-                        case 4: z1 = std::stoi(s1); break;
-                        case 5: z2 = std::stoi(s1); break;
-                        case 6: cx = std::stod(s1); break;
-                        case 7: cy = std::stod(s1); break;
-                    }
-                    
-                    s0.erase(0, cpos + 1);
-                    i++;
-                }
-                cz = std::stod(s0);
+                return parse(str);
+            }
+
+            /**
+             * Parses a 3D coordinate matrix such as "(0, 1, 0, 1, 0, 1)^[2, 2, 2]", usable in constant expressions.
+             * @param str The string to parse.
+             * @return The parsed coordinate matrix.
+             * @throws std::invalid_argument if the string is not a 3D coordinate matrix.
+             */
+            static constexpr LevelZ::CoordinateMatrix3D parse(std::string_view str) {
+                size_t caret = str.find('^');
+                if (caret == std::string_view::npos) throw std::invalid_argument("Invalid 3D coordinate matrix");
 
-                return CoordinateMatrix3D(x1, x2, y1, y2, z1, z2, LevelZ::Coordinate3D(cx, cy, cz));
+                std::array<int, 6> b = parseMatrixBounds<6>(str.substr(0, caret));
+                return CoordinateMatrix3D(b[0], b[1], b[2], b[3], b[4], b[5], LevelZ::Coordinate3D::parse(str.substr(caret + 1)));
             }
     };
 }
\ No newline at end of file
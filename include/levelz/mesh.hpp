@@ -0,0 +1,398 @@
+#pragma once
+
+#include <map>
+#include <array>
+#include <deque>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+
+#include "coordinate.hpp"
+#include "block.hpp"
+#include "level.hpp"
+#include "world.hpp"
+
+namespace LevelZ {
+
+    /**
+     * A rectangle of block faces that share a plane, a facing direction and a material.
+     */
+    struct MeshQuad {
+        public:
+            /**
+             * The corner of the quad with the lowest coordinates, in cell units.
+             */
+            std::array<int, 3> origin;
+
+            /**
+             * The axis the quad faces along: 0 for x, 1 for y and 2 for z.
+             */
+            int axis;
+
+            /**
+             * Whether the quad faces towards the positive end of its axis.
+             */
+            bool positive;
+
+            /**
+             * The size of the quad along the axis after its own, wrapping from z to x.
+             */
+            int width;
+
+            /**
+             * The size of the quad along the remaining axis.
+             */
+            int height;
+
+            /**
+             * The material of the quad, which is the index of its block in the palette of the world.
+             */
+            uint32_t material;
+
+            /**
+             * Gets the outward normal of the quad.
+             * @return The unit normal of the quad.
+             */
+            Coordinate3D normal() const {
+                double n[3] = {0.0, 0.0, 0.0};
+                n[axis] = positive ? 1.0 : -1.0;
+                return Coordinate3D(n[0], n[1], n[2]);
+            }
+
+            /**
+             * Gets the corners of the quad, counter-clockwise when seen from the side its normal points to.
+             * @return The four corners of the quad.
+             */
+            std::array<Coordinate3D, 4> corners() const {
+                const int u = (axis + 1) % 3, v = (axis + 2) % 3;
+
+                std::array<std::array<int, 3>, 4> c = {origin, origin, origin, origin};
+                c[1][u] += width;
+                c[2][u] += width;
+                c[2][v] += height;
+                c[3][v] += height;
+                if (!positive) std::swap(c[1], c[3]);
+
+                std::array<Coordinate3D, 4> corners = {Coordinate3D(0.0, 0.0, 0.0), Coordinate3D(0.0, 0.0, 0.0), Coordinate3D(0.0, 0.0, 0.0), Coordinate3D(0.0, 0.0, 0.0)};
+                for (size_t i = 0; i < 4; i++)
+                    corners[i] = Coordinate3D(static_cast<double>(c[i][0]), static_cast<double>(c[i][1]), static_cast<double>(c[i][2]));
+
+                return corners;
+            }
+    };
+
+    /**
+     * The triangles of a mesh in flat arrays, ready to upload to a renderer or a physics engine.
+     */
+    struct MeshBuffers {
+        public:
+            /**
+             * The x, y and z coordinates of each vertex.
+             */
+            std::vector<float> positions;
+
+            /**
+             * The x, y and z components of the normal of each vertex.
+             */
+            std::vector<float> normals;
+
+            /**
+             * The material of each vertex.
+             */
+            std::vector<uint32_t> materials;
+
+            /**
+             * The vertices of each triangle, three per triangle, counter-clockwise when seen from the front.
+             */
+            std::vector<uint32_t> indices;
+    };
+
+    /**
+     * Builds meshes of the visible faces of the blocks in a 3D world, one chunk at a time.
+     *
+     * Faces between two blocks are hidden and skipped, and the remaining faces of each chunk are merged greedily into as few
+     * rectangles as possible per plane, direction and material. Every block is treated as an opaque unit cube in the cell
+     * containing its coordinate. Chunks are the sections of the ChunkedWorld3D holding the blocks, and edits only re-mesh the
+     * chunks they touch.
+     */
+    struct GreedyMesher {
+        private:
+            using Chunk = std::array<int, 3>;
+            static constexpr int SIZE = ChunkedWorld3D::SECTION_SIZE;
+
+            ChunkedWorld3D _world;
+            std::map<Chunk, std::vector<MeshQuad>> _meshes;
+            std::vector<Chunk> _dirty;
+
+            static int floorDiv(int value) {
+                return value >= 0 ? value / SIZE : -((-value + SIZE - 1) / SIZE);
+            }
+
+            void mark(int x, int y, int z) {
+                const Chunk chunk = {floorDiv(x), floorDiv(y), floorDiv(z)};
+                _dirty.push_back(chunk);
+
+                // a cell on the border of a chunk also hides or shows a face of a block in the neighbouring chunk
+                const int local[3] = {x - chunk[0] * SIZE, y - chunk[1] * SIZE, z - chunk[2] * SIZE};
+                for (int axis = 0; axis < 3; axis++) {
+                    int step;
+                    if (local[axis] == 0) step = -1;
+                    else if (local[axis] == SIZE - 1) step = 1;
+                    else continue;
+
+                    std::array<int, 3> cell = {x, y, z};
+                    cell[axis] += step;
+                    if (_world.blockId(cell[0], cell[1], cell[2]) == 0) continue;
+
+                    Chunk neighbour = chunk;
+                    neighbour[axis] += step;
+                    _dirty.push_back(neighbour);
+                }
+            }
+
+            std::vector<MeshQuad> mesh(const Chunk& chunk) const {
+                constexpr int PADDED = SIZE + 2;
+                const int bx = chunk[0] * SIZE, by = chunk[1] * SIZE, bz = chunk[2] * SIZE;
+
+                // block ids of the chunk and a one cell border around it
+                std::vector<uint32_t> ids(PADDED * PADDED * PADDED);
+                auto at = [&ids](int x, int y, int z) -> uint32_t& {
+                    return ids[(static_cast<size_t>(y + 1) * PADDED + static_cast<size_t>(z + 1)) * PADDED + static_cast<size_t>(x + 1)];
+                };
+
+                bool empty = true;
+                for (int y = -1; y <= SIZE; y++)
+                    for (int z = -1; z <= SIZE; z++)
+                        for (int x = -1; x <= SIZE; x++) {
+                            at(x, y, z) = _world.blockId(bx + x, by + y, bz + z);
+                            if (at(x, y, z) != 0 && x >= 0 && x < SIZE && y >= 0 && y < SIZE && z >= 0 && z < SIZE) empty = false;
+                        }
+
+                std::vector<MeshQuad> quads;
+                if (empty) return quads;
+
+                std::array<uint32_t, SIZE * SIZE> mask;
+                for (int axis = 0; axis < 3; axis++) {
+                    const int u = (axis + 1) % 3, v = (axis + 2) % 3;
+
+                    for (int direction = -1; direction <= 1; direction += 2)
+                        for (int d = 0; d < SIZE; d++) {
+                            // the material of each visible face in the slice, plus one, or 0 where there is none
+                            int p[3], q[3];
+                            for (int j = 0; j < SIZE; j++)
+                                for (int i = 0; i < SIZE; i++) {
+                                    p[axis] = d; p[u] = i; p[v] = j;
+                                    q[axis] = d + direction; q[u] = i; q[v] = j;
+
+                                    const uint32_t id = at(p[0], p[1], p[2]);
+                                    mask[j * SIZE + i] = id != 0 && at(q[0], q[1], q[2]) == 0 ? id : 0;
+                                }
+
+                            for (int j = 0; j < SIZE; j++)
+                                for (int i = 0; i < SIZE;) {
+                                    const uint32_t id = mask[j * SIZE + i];
+                                    if (id == 0) {
+                                        i++;
+                                        continue;
+                                    }
+
+                                    int width = 1;
+                                    while (i + width < SIZE && mask[j * SIZE + i + width] == id) width++;
+
+                                    int height = 1;
+                                    for (; j + height < SIZE; height++) {
+                                        bool full = true;
+                                        for (int k = 0; k < width && full; k++)
+                                            full = mask[(j + height) * SIZE + i + k] == id;
+
+                                        if (!full) break;
+                                    }
+
+                                    for (int h = 0; h < height; h++)
+                                        std::fill_n(mask.begin() + (j + h) * SIZE + i, width, 0u);
+
+                                    MeshQuad quad;
+                                    quad.origin = {bx, by, bz};
+                                    quad.origin[axis] += d + (direction > 0 ? 1 : 0);
+                                    quad.origin[u] += i;
+                                    quad.origin[v] += j;
+                                    quad.axis = axis;
+                                    quad.positive = direction > 0;
+                                    quad.width = width;
+                                    quad.height = height;
+                                    quad.material = id - 1;
+                                    quads.push_back(quad);
+
+                                    i += width;
+                                }
+                        }
+                }
+
+                return quads;
+            }
+
+        public:
+            /**
+             * Constructs a mesher over the blocks of a level. Later blocks replace earlier blocks in the same cell.
+             * @param level The level to mesh.
+             */
+            explicit GreedyMesher(const Level& level) : GreedyMesher(ChunkedWorld3D(level)) {}
+
+            /**
+             * Constructs a mesher over a world.
+             * @param world The world to mesh.
+             */
+            explicit GreedyMesher(ChunkedWorld3D world) : _world(std::move(world)), _dirty(_world.chunks()) {}
+
+            /**
+             * Gets the world being meshed.
+             * @return The world of the mesher.
+             */
+            inline const ChunkedWorld3D& world() const {
+                return _world;
+            }
+
+            /**
+             * Gets the blocks that material ids refer to.
+             * @return The blocks, indexed by material.
+             */
+            inline const std::deque<Block>& materials() const {
+                return _world.palette();
+            }
+
+            /**
+             * Places a block in a cell and marks the chunks whose meshes it changes as dirty.
+             * @param x The x coordinate of the cell.
+             * @param y The y coordinate of the cell.
+             * @param z The z coordinate of the cell.
+             * @param block The block to place.
+             */
+            void set(int x, int y, int z, const Block& block) {
+                _world.set(x, y, z, block);
+                mark(x, y, z);
+            }
+
+            /**
+             * Empties a cell and marks the chunks whose meshes it changes as dirty.
+             * @param x The x coordinate of the cell.
+             * @param y The y coordinate of the cell.
+             * @param z The z coordinate of the cell.
+             * @return true if the cell contained a block, false otherwise
+             */
+            bool erase(int x, int y, int z) {
+                if (!_world.erase(x, y, z)) return false;
+
+                mark(x, y, z);
+                return true;
+            }
+
+            /**
+             * Gets the number of chunks waiting to be re-meshed.
+             * @return The number of dirty chunks.
+             */
+            size_t dirty() const {
+                std::vector<Chunk> chunks = _dirty;
+                std::sort(chunks.begin(), chunks.end());
+                return static_cast<size_t>(std::unique(chunks.begin(), chunks.end()) - chunks.begin());
+            }
+
+            /**
+             * Re-meshes the dirty chunks, splitting them between threads.
+             * @param threads The number of threads to mesh with, or 0 for the number of hardware threads.
+             * @return The number of chunks that were re-meshed.
+             */
+            size_t update(size_t threads = 0) {
+                std::sort(_dirty.begin(), _dirty.end());
+                _dirty.erase(std::unique(_dirty.begin(), _dirty.end()), _dirty.end());
+
+                const size_t n = _dirty.size();
+                if (threads == 0) threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+                threads = std::max<size_t>(1, std::min(threads, n));
+
+                std::vector<std::vector<MeshQuad>> meshes(n);
+                auto task = [&](size_t t) {
+                    for (size_t i = t; i < n; i += threads)
+                        meshes[i] = mesh(_dirty[i]);
+                };
+
+                std::vector<std::thread> pool;
+                for (size_t t = 1; t < threads; t++)
+                    pool.emplace_back(task, t);
+
+                task(0);
+                for (std::thread& thread : pool) thread.join();
+
+                for (size_t i = 0; i < n; i++) {
+                    if (meshes[i].empty()) _meshes.erase(_dirty[i]);
+                    else _meshes[_dirty[i]] = std::move(meshes[i]);
+                }
+
+                _dirty.clear();
+                return n;
+            }
+
+            /**
+             * Gets the quads of every chunk, as of the last update.
+             * @return The quads of each non-empty chunk, by chunk coordinates.
+             */
+            inline const std::map<std::array<int, 3>, std::vector<MeshQuad>>& chunks() const {
+                return _meshes;
+            }
+
+            /**
+             * Gets the quads of a chunk, as of the last update.
+             * @param x The x coordinate of the chunk.
+             * @param y The y coordinate of the chunk.
+             * @param z The z coordinate of the chunk.
+             * @return The quads of the chunk, or nullptr if it has no visible faces.
+             */
+            const std::vector<MeshQuad>* chunk(int x, int y, int z) const {
+                auto it = _meshes.find({x, y, z});
+                return it == _meshes.end() ? nullptr : &it->second;
+            }
+
+            /**
+             * Gets the total number of quads, as of the last update.
+             * @return The number of quads in every chunk.
+             */
+            size_t quads() const {
+                size_t count = 0;
+                for (auto const& [k, quads] : _meshes)
+                    count += quads.size();
+
+                return count;
+            }
+
+            /**
+             * Builds the triangles of every chunk, as of the last update, with two triangles per quad.
+             * @return The vertices and triangles of the mesh.
+             */
+            MeshBuffers buffers() const {
+                MeshBuffers buffers;
+                const size_t count = quads();
+                buffers.positions.reserve(count * 12);
+                buffers.normals.reserve(count * 12);
+                buffers.materials.reserve(count * 4);
+                buffers.indices.reserve(count * 6);
+
+                for (auto const& [k, quads] : _meshes)
+                    for (const MeshQuad& quad : quads) {
+                        const uint32_t base = static_cast<uint32_t>(buffers.materials.size());
+                        const Coordinate3D normal = quad.normal();
+
+                        for (const Coordinate3D& corner : quad.corners()) {
+                            buffers.positions.insert(buffers.positions.end(), {static_cast<float>(corner.x), static_cast<float>(corner.y), static_cast<float>(corner.z)});
+                            buffers.normals.insert(buffers.normals.end(), {static_cast<float>(normal.x), static_cast<float>(normal.y), static_cast<float>(normal.z)});
+                            buffers.materials.push_back(quad.material);
+                        }
+
+                        buffers.indices.insert(buffers.indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+                    }
+
+                return buffers;
+            }
+    };
+
+}
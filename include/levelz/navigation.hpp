@@ -0,0 +1,403 @@
+#pragma once
+
+#include <cmath>
+#include <queue>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "coordinate.hpp"
+#include "block.hpp"
+#include "level.hpp"
+#include "diff.hpp"
+
+namespace LevelZ {
+
+    /**
+     * A grid of the walkable cells of a 2D level, with connected components and cached shortest paths.
+     *
+     * The grid covers the bounding box of the level's blocks, grown by a padding, and stores one bit per cell. Cells containing a
+     * blocking block are not walkable, and neither is anything outside the grid. Blocks occupy the cell containing their coordinate.
+     * Editing cells updates the grid in place instead of rebuilding it from the level, and keeps the component labels where
+     * the edit cannot merge or split components. Components, paths and their caches are computed on first use and are not
+     * synchronized, so a grid should not be queried from several threads at once.
+     */
+    struct NavigationGrid2D {
+        public:
+            /**
+             * Decides whether a block blocks movement through its cell.
+             */
+            using Blocking = std::function<bool(const Block&)>;
+
+        private:
+            int _x, _y;
+            int _width = 0, _height = 0;
+            std::vector<uint64_t> _blocked;
+            Blocking _blocking;
+
+            mutable std::vector<uint32_t> _labels;
+            mutable uint32_t _components = 0;
+            mutable bool _labelled = false;
+
+            mutable std::unordered_map<uint64_t, std::vector<Coordinate2D>> _paths;
+            mutable std::vector<double> _cost;
+            mutable std::vector<uint32_t> _parent;
+            mutable std::vector<uint32_t> _visited;
+            mutable uint32_t _search = 0;
+
+            // the number of paths to cache before the cache is cleared
+            static constexpr size_t CACHE_SIZE = 4096;
+
+            bool inside(int x, int y) const {
+                return x >= _x && y >= _y && x < _x + _width && y < _y + _height;
+            }
+
+            size_t index(int x, int y) const {
+                return static_cast<size_t>(y - _y) * static_cast<size_t>(_width) + static_cast<size_t>(x - _x);
+            }
+
+            bool walkable(size_t i) const {
+                return ((_blocked[i / 64] >> (i % 64)) & 1) == 0;
+            }
+
+            bool blocks(const Block& block) const {
+                return !_blocking || _blocking(block);
+            }
+
+            template <typename F>
+            void neighbours(size_t i, bool diagonal, F&& visit) const {
+                const int x = static_cast<int>(i % _width), y = static_cast<int>(i / _width);
+                for (int dy = -1; dy <= 1; dy++)
+                    for (int dx = -1; dx <= 1; dx++) {
+                        if ((dx == 0 && dy == 0) || (!diagonal && dx != 0 && dy != 0)) continue;
+
+                        const int nx = x + dx, ny = y + dy;
+                        if (nx < 0 || ny < 0 || nx >= _width || ny >= _height) continue;
+
+                        const size_t n = static_cast<size_t>(ny) * _width + nx;
+                        if (!walkable(n)) continue;
+
+                        // diagonal moves may not cut the corner of a blocked cell
+                        if (dx != 0 && dy != 0 && (!walkable(static_cast<size_t>(y) * _width + nx) || !walkable(static_cast<size_t>(ny) * _width + x))) continue;
+
+                        visit(n, dx != 0 && dy != 0);
+                    }
+            }
+
+            void label() const {
+                const size_t cells = static_cast<size_t>(_width) * _height;
+                _labels.assign(cells, 0);
+                _components = 0;
+
+                std::vector<size_t> stack;
+                for (size_t start = 0; start < cells; start++) {
+                    if (_labels[start] != 0 || !walkable(start)) continue;
+
+                    _labels[start] = ++_components;
+                    stack.push_back(start);
+                    while (!stack.empty()) {
+                        size_t i = stack.back();
+                        stack.pop_back();
+
+                        neighbours(i, false, [this, &stack](size_t n, bool) {
+                            if (_labels[n] != 0) return;
+
+                            _labels[n] = _components;
+                            stack.push_back(n);
+                        });
+                    }
+                }
+
+                _labelled = true;
+            }
+
+            void set(int x, int y, bool blocked) {
+                if (!inside(x, y)) return;
+
+                const size_t i = index(x, y);
+                if (walkable(i) == !blocked) return;
+
+                if (blocked) _blocked[i / 64] |= uint64_t(1) << (i % 64);
+                else _blocked[i / 64] &= ~(uint64_t(1) << (i % 64));
+
+                _paths.clear();
+                if (!_labelled) return;
+
+                if (blocked) {
+                    // removing a cell can only split its component if it has several walkable neighbours
+                    size_t open = 0;
+                    neighbours(i, false, [&open](size_t, bool) { open++; });
+
+                    _labels[i] = 0;
+                    if (open > 1) _labelled = false;
+                } else {
+                    // a new cell joins the single component around it, or starts its own
+                    std::vector<uint32_t> around;
+                    neighbours(i, false, [this, &around](size_t n, bool) { around.push_back(_labels[n]); });
+
+                    std::sort(around.begin(), around.end());
+                    around.erase(std::unique(around.begin(), around.end()), around.end());
+
+                    if (around.empty()) _labels[i] = ++_components;
+                    else if (around.size() == 1) _labels[i] = around[0];
+                    else _labelled = false;
+                }
+            }
+
+        public:
+            /**
+             * Constructs a navigation grid from the blocks of a level.
+             * @param level The level to read the blocks from.
+             * @param padding The number of walkable cells to add around the bounding box of the blocks.
+             * @param blocking Decides which blocks block movement, or nullptr for every block.
+             * @throws std::invalid_argument if the padding is negative.
+             */
+            explicit NavigationGrid2D(const Level& level, int padding = 1, Blocking blocking = nullptr) : _blocking(std::move(blocking)) {
+                if (padding < 0) throw std::invalid_argument("Padding must not be negative");
+
+                const LevelStats& stats = level.stats();
+                _x = static_cast<int>(std::floor(stats.min.x)) - padding;
+                _y = static_cast<int>(std::floor(stats.min.y)) - padding;
+                _width = stats.empty() ? 0 : static_cast<int>(std::floor(stats.max.x)) + padding - _x + 1;
+                _height = stats.empty() ? 0 : static_cast<int>(std::floor(stats.max.y)) + padding - _y + 1;
+                _blocked.assign((static_cast<size_t>(_width) * _height + 63) / 64, 0);
+
+                for (const LevelObject& o : level.blocks())
+                    if (blocks(o.block()))
+                        set(static_cast<int>(std::floor(o.coordinate3D().x)), static_cast<int>(std::floor(o.coordinate3D().y)), true);
+            }
+
+            /**
+             * Constructs an empty navigation grid where every cell is walkable.
+             * @param x The x coordinate of the lowest cell.
+             * @param y The y coordinate of the lowest cell.
+             * @param width The number of cells along the x axis.
+             * @param height The number of cells along the y axis.
+             * @param blocking Decides which blocks block movement, or nullptr for every block.
+             * @throws std::invalid_argument if the width or height is negative.
+             */
+            NavigationGrid2D(int x, int y, int width, int height, Blocking blocking = nullptr) : _x(x), _y(y), _width(width), _height(height), _blocking(std::move(blocking)) {
+                if (width < 0 || height < 0) throw std::invalid_argument("Grid size must not be negative");
+
+                _blocked.assign((static_cast<size_t>(_width) * _height + 63) / 64, 0);
+            }
+
+            /**
+             * Gets the x coordinate of the lowest cell in the grid.
+             * @return The lowest x coordinate.
+             */
+            inline int x() const {
+                return _x;
+            }
+
+            /**
+             * Gets the y coordinate of the lowest cell in the grid.
+             * @return The lowest y coordinate.
+             */
+            inline int y() const {
+                return _y;
+            }
+
+            /**
+             * Gets the number of cells along the x axis.
+             * @return The width of the grid.
+             */
+            inline int width() const {
+                return _width;
+            }
+
+            /**
+             * Gets the number of cells along the y axis.
+             * @return The height of the grid.
+             */
+            inline int height() const {
+                return _height;
+            }
+
+            /**
+             * Gets whether a cell can be walked through.
+             * @param x The x coordinate of the cell.
+             * @param y The y coordinate of the cell.
+             * @return true if the cell is inside the grid and not blocked, false otherwise
+             */
+            bool walkable(int x, int y) const {
+                return inside(x, y) && walkable(index(x, y));
+            }
+
+            /**
+             * Blocks or unblocks a cell. Cells outside the grid are ignored.
+             * @param x The x coordinate of the cell.
+             * @param y The y coordinate of the cell.
+             * @param walkable Whether the cell can be walked through.
+             */
+            void setWalkable(int x, int y, bool walkable) {
+                set(x, y, !walkable);
+            }
+
+            /**
+             * Updates the cell of a block that was placed, blocking it if the block blocks movement and unblocking it otherwise.
+             * @param object The block that was placed.
+             */
+            void place(const LevelObject& object) {
+                const Coordinate3D c = object.coordinate3D();
+                set(static_cast<int>(std::floor(c.x)), static_cast<int>(std::floor(c.y)), blocks(object.block()));
+            }
+
+            /**
+             * Unblocks the cell of a block that was removed.
+             * @param object The block that was removed.
+             */
+            void remove(const LevelObject& object) {
+                const Coordinate3D c = object.coordinate3D();
+                set(static_cast<int>(std::floor(c.x)), static_cast<int>(std::floor(c.y)), false);
+            }
+
+            /**
+             * Updates the cells of every block in a diff of the level.
+             * @param diff The changes to the level.
+             */
+            void apply(const LevelDiff& diff) {
+                for (const LevelObject& o : diff.removed) remove(o);
+                for (const BlockChange& change : diff.changed) place(change.after);
+                for (const LevelObject& o : diff.added) place(o);
+            }
+
+            /**
+             * Gets the number of connected areas of walkable cells, moving between cells that share an edge.
+             * @return The number of components.
+             */
+            size_t components() const {
+                if (!_labelled) label();
+
+                std::vector<bool> seen(static_cast<size_t>(_components) + 1, false);
+                size_t count = 0;
+                for (uint32_t l : _labels)
+                    if (l != 0 && !seen[l]) {
+                        seen[l] = true;
+                        count++;
+                    }
+
+                return count;
+            }
+
+            /**
+             * Gets the connected area a cell belongs to. Cells in the same area have the same component.
+             * @param x The x coordinate of the cell.
+             * @param y The y coordinate of the cell.
+             * @return The component of the cell, or 0 if the cell is not walkable.
+             */
+            uint32_t component(int x, int y) const {
+                if (!inside(x, y)) return 0;
+                if (!_labelled) label();
+
+                return _labels[index(x, y)];
+            }
+
+            /**
+             * Gets whether a cell can be reached from another by moving between cells that share an edge.
+             * @param x0 The x coordinate of the first cell.
+             * @param y0 The y coordinate of the first cell.
+             * @param x1 The x coordinate of the second cell.
+             * @param y1 The y coordinate of the second cell.
+             * @return true if both cells are walkable and connected, false otherwise
+             */
+            bool connected(int x0, int y0, int x1, int y1) const {
+                uint32_t c = component(x0, y0);
+                return c != 0 && c == component(x1, y1);
+            }
+
+            /**
+             * Finds a shortest path between two cells with A*. Paths are cached until the grid changes.
+             *
+             * Cells in different components are rejected without searching. Diagonal moves cost the square root of 2 and may
+             * not cut the corner of a blocked cell, so the components are the same with and without them.
+             * @param x0 The x coordinate of the start cell.
+             * @param y0 The y coordinate of the start cell.
+             * @param x1 The x coordinate of the goal cell.
+             * @param y1 The y coordinate of the goal cell.
+             * @param diagonal Whether to allow diagonal moves.
+             * @return The cells of the path, from the start to the goal, or an empty path if the goal cannot be reached.
+             */
+            std::vector<Coordinate2D> path(int x0, int y0, int x1, int y1, bool diagonal = false) const {
+                if (!connected(x0, y0, x1, y1)) return {};
+
+                const size_t start = index(x0, y0), goal = index(x1, y1);
+                const size_t cells = static_cast<size_t>(_width) * _height;
+                const uint64_t key = (static_cast<uint64_t>(start) * cells + goal) * 2 + (diagonal ? 1 : 0);
+
+                auto cached = _paths.find(key);
+                if (cached != _paths.end()) return cached->second;
+                if (_paths.size() >= CACHE_SIZE) _paths.clear();
+
+                if (_visited.size() != cells) {
+                    _cost.assign(cells, 0);
+                    _parent.assign(cells, 0);
+                    _visited.assign(cells, 0);
+                    _search = 0;
+                }
+
+                // searches are told apart by number, so the arrays never need clearing
+                if (++_search == 0) {
+                    std::fill(_visited.begin(), _visited.end(), 0);
+                    _search = 1;
+                }
+
+                const double root2 = std::sqrt(2.0);
+                auto estimate = [this, x1, y1, diagonal, root2](size_t i) {
+                    const double dx = std::abs(static_cast<int>(i % _width) + _x - x1), dy = std::abs(static_cast<int>(i / _width) + _y - y1);
+                    return diagonal ? std::max(dx, dy) + (root2 - 1) * std::min(dx, dy) : dx + dy;
+                };
+
+                using Entry = std::pair<double, size_t>;
+                std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+
+                _cost[start] = 0;
+                _visited[start] = _search;
+                open.push(Entry(estimate(start), start));
+
+                while (!open.empty()) {
+                    auto [f, i] = open.top();
+                    open.pop();
+
+                    if (i == goal) break;
+                    if (f > _cost[i] + estimate(i) + 1e-9) continue;
+
+                    neighbours(i, diagonal, [&](size_t n, bool diagonalMove) {
+                        const double cost = _cost[i] + (diagonalMove ? root2 : 1.0);
+                        if (_visited[n] == _search && _cost[n] <= cost) return;
+
+                        _visited[n] = _search;
+                        _cost[n] = cost;
+                        _parent[n] = static_cast<uint32_t>(i);
+                        open.push(Entry(cost + estimate(n), n));
+                    });
+                }
+
+                std::vector<Coordinate2D> result;
+                for (size_t i = goal;; i = _parent[i]) {
+                    result.push_back(Coordinate2D(static_cast<double>(static_cast<int>(i % _width) + _x), static_cast<double>(static_cast<int>(i / _width) + _y)));
+                    if (i == start) break;
+                }
+
+                std::reverse(result.begin(), result.end());
+                _paths.emplace(key, result);
+                return result;
+            }
+
+            /**
+             * Finds a shortest path between the cells containing two coordinates with A*.
+             * @param from The start coordinate.
+             * @param to The goal coordinate.
+             * @param diagonal Whether to allow diagonal moves.
+             * @return The cells of the path, from the start to the goal, or an empty path if the goal cannot be reached.
+             */
+            std::vector<Coordinate2D> path(const Coordinate2D& from, const Coordinate2D& to, bool diagonal = false) const {
+                return path(static_cast<int>(std::floor(from.x)), static_cast<int>(std::floor(from.y)), static_cast<int>(std::floor(to.x)), static_cast<int>(std::floor(to.y)), diagonal);
+            }
+    };
+
+}
@@ -0,0 +1,328 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "coordinate.hpp"
+#include "block.hpp"
+#include "level.hpp"
+
+namespace LevelZ {
+
+    /**
+     * A placement of a shared, immutable level inside another level, moved by an offset.
+     *
+     * Any number of instances can share the same prefab, so stamping a structure many times stores its blocks only once.
+     */
+    struct LevelInstance {
+        public:
+            /**
+             * The level placed by the instance.
+             */
+            std::shared_ptr<const Level> prefab;
+
+            /**
+             * The offset added to the coordinates of the blocks of the prefab. The z coordinate is 0 for 2D prefabs.
+             */
+            Coordinate3D offset;
+
+            /**
+             * Constructs a new instance of a 2D prefab.
+             * @param prefab The level to place.
+             * @param offset The offset to place the level at.
+             * @throws std::invalid_argument if the prefab is null.
+             */
+            LevelInstance(std::shared_ptr<const Level> prefab, Coordinate2D offset) : LevelInstance(std::move(prefab), Coordinate3D(offset.x, offset.y, 0.0)) {}
+
+            /**
+             * Constructs a new instance of a 3D prefab.
+             * @param prefab The level to place.
+             * @param offset The offset to place the level at.
+             * @throws std::invalid_argument if the prefab is null.
+             */
+            LevelInstance(std::shared_ptr<const Level> prefab, Coordinate3D offset) : prefab(std::move(prefab)), offset(offset) {
+                if (!this->prefab) throw std::invalid_argument("Prefab must not be null");
+            }
+
+            /**
+             * Gets whether the prefab is a 2D level.
+             * @return true if the prefab is 2D, false if it is 3D
+             */
+            inline bool is2D() const {
+                return prefab->header().is2D();
+            }
+
+            /**
+             * Gets the number of blocks placed by the instance.
+             * @return The number of blocks in the prefab.
+             */
+            inline size_t size() const {
+                return prefab->blocks().size();
+            }
+
+            /**
+             * Gets the minimum corner of the bounding box of the placed blocks.
+             * @return The minimum corner, moved by the offset.
+             */
+            inline Coordinate3D min() const {
+                return prefab->stats().min + offset;
+            }
+
+            /**
+             * Gets the maximum corner of the bounding box of the placed blocks.
+             * @return The maximum corner, moved by the offset.
+             */
+            inline Coordinate3D max() const {
+                return prefab->stats().max + offset;
+            }
+
+            /**
+             * Gets whether a coordinate is inside the bounding box of the placed blocks.
+             * @param c The coordinate to check.
+             * @return true if the coordinate is inside the bounding box, false otherwise
+             */
+            bool contains(const Coordinate3D& c) const {
+                if (prefab->blocks().empty()) return false;
+
+                const Coordinate3D low = min(), high = max();
+                return c.x >= low.x && c.x <= high.x && c.y >= low.y && c.y <= high.y && c.z >= low.z && c.z <= high.z;
+            }
+    };
+
+    /**
+     * A level composed of its own blocks and of instances of shared prefab levels, which are resolved lazily instead of copied.
+     *
+     * Instances are stacked in the order they are placed and the level's own blocks are placed on top of them, so where blocks
+     * overlap, the level's own blocks win over instances and later instances win over earlier ones, as when parsing a flattened level.
+     * Lookups index each prefab once and share the index between all of its instances. The indices are built on first use
+     * and are not synchronized, so a level should not be queried from several threads before its first lookup.
+     */
+    struct InstancedLevel {
+        private:
+            std::unordered_map<std::string, std::string> _headers;
+            bool _is2D;
+            std::vector<LevelObject> _blocks;
+            std::vector<LevelInstance> _instances;
+
+            mutable std::unordered_map<Coordinate3D, size_t> _index;
+            mutable bool _indexed = false;
+            mutable std::unordered_map<const Level*, std::unordered_map<Coordinate3D, size_t>> _prefabs;
+
+            // the index of the last block at each coordinate
+            template <typename Blocks>
+            static void build(std::unordered_map<Coordinate3D, size_t>& index, const Blocks& blocks) {
+                index.reserve(blocks.size());
+                for (size_t i = 0; i < blocks.size(); i++)
+                    index[blocks[i].coordinate3D()] = i;
+            }
+
+            const std::unordered_map<Coordinate3D, size_t>& index(const Level& prefab) const {
+                auto it = _prefabs.find(&prefab);
+                if (it != _prefabs.end()) return it->second;
+
+                std::unordered_map<Coordinate3D, size_t>& index = _prefabs[&prefab];
+                build(index, prefab.blocks());
+                return index;
+            }
+
+        public:
+            /**
+             * Constructs a new, empty level.
+             * @param headers The headers of the level. Its type header decides whether it is 2D or 3D, and defaults to 2D.
+             */
+            explicit InstancedLevel(const std::unordered_map<std::string, std::string>& headers = {{"type", "2"}}) : _headers(headers) {
+                _is2D = LevelHeader::parse(_headers).is2D();
+                if (_headers.find("type") == _headers.end()) _headers["type"] = "2";
+            }
+
+            /**
+             * Constructs a new level with the headers and blocks of another level and no instances.
+             * @param level The level to copy.
+             */
+            explicit InstancedLevel(const Level& level) : _headers(level.headers()), _is2D(level.header().is2D()), _blocks(level.blocks().begin(), level.blocks().end()) {
+                if (_headers.find("type") == _headers.end()) _headers["type"] = _is2D ? "2" : "3";
+            }
+
+            /**
+             * Gets the headers of the level.
+             * @return The headers of the level.
+             */
+            inline const std::unordered_map<std::string, std::string>& headers() const {
+                return _headers;
+            }
+
+            /**
+             * Gets whether the level is 2D.
+             * @return true if the level is 2D, false if it is 3D
+             */
+            inline bool is2D() const {
+                return _is2D;
+            }
+
+            /**
+             * Gets the level's own blocks, without the blocks of its instances.
+             * @return The blocks of the level.
+             */
+            inline const std::vector<LevelObject>& blocks() const {
+                return _blocks;
+            }
+
+            /**
+             * Gets the instances in the level.
+             * @return The instances, in the order they were placed.
+             */
+            inline const std::vector<LevelInstance>& instances() const {
+                return _instances;
+            }
+
+            /**
+             * Gets the number of blocks in the level, counting the blocks of every instance and any blocks hidden by overlaps.
+             * @return The number of blocks.
+             */
+            size_t size() const {
+                size_t size = _blocks.size();
+                for (const LevelInstance& instance : _instances)
+                    size += instance.size();
+
+                return size;
+            }
+
+            /**
+             * Adds a block to the level, on top of every instance.
+             * @param block The block to add.
+             */
+            void add(LevelObject block) {
+                _blocks.push_back(std::move(block));
+                _indexed = false;
+            }
+
+            /**
+             * Places an instance of a 2D prefab, on top of earlier instances.
+             * @param prefab The level to place.
+             * @param offset The offset to place the level at.
+             * @return The index of the instance.
+             * @throws std::invalid_argument if the prefab is null or this level is 3D.
+             */
+            size_t place(std::shared_ptr<const Level> prefab, Coordinate2D offset) {
+                return place(LevelInstance(std::move(prefab), offset));
+            }
+
+            /**
+             * Places an instance of a 3D prefab, on top of earlier instances.
+             * @param prefab The level to place.
+             * @param offset The offset to place the level at.
+             * @return The index of the instance.
+             * @throws std::invalid_argument if the prefab is null or this level is 2D.
+             */
+            size_t place(std::shared_ptr<const Level> prefab, Coordinate3D offset) {
+                return place(LevelInstance(std::move(prefab), offset));
+            }
+
+            /**
+             * Places an instance of a prefab, on top of earlier instances.
+             * @param instance The instance to place.
+             * @return The index of the instance.
+             * @throws std::invalid_argument if the prefab does not have the same number of dimensions as this level.
+             */
+            size_t place(LevelInstance instance) {
+                if (instance.is2D() != _is2D) throw std::invalid_argument(std::string("Cannot place a ") + (instance.is2D() ? "2D" : "3D") + " prefab in a " + (_is2D ? "2D" : "3D") + " level");
+
+                _instances.push_back(std::move(instance));
+                return _instances.size() - 1;
+            }
+
+            /**
+             * Removes every instance of a prefab.
+             * @param prefab The prefab to remove.
+             * @return The number of instances removed.
+             */
+            size_t remove(const std::shared_ptr<const Level>& prefab) {
+                size_t before = _instances.size();
+                _instances.erase(std::remove_if(_instances.begin(), _instances.end(), [&prefab](const LevelInstance& instance) {
+                    return instance.prefab == prefab;
+                }), _instances.end());
+
+                _prefabs.erase(prefab.get());
+                return before - _instances.size();
+            }
+
+            /**
+             * Finds the block that is visible at a coordinate.
+             * @param c The coordinate to look up.
+             * @return The block, or nullptr if there is none. Valid until the level or the prefab holding it changes.
+             */
+            const Block* find(const Coordinate2D& c) const {
+                return find(Coordinate3D(c.x, c.y, 0.0));
+            }
+
+            /**
+             * Finds the block that is visible at a coordinate.
+             * @param c The coordinate to look up.
+             * @return The block, or nullptr if there is none. Valid until the level or the prefab holding it changes.
+             */
+            const Block* find(const Coordinate3D& c) const {
+                if (!_indexed) {
+                    _index.clear();
+                    build(_index, _blocks);
+                    _indexed = true;
+                }
+
+                auto own = _index.find(c);
+                if (own != _index.end()) return &_blocks[own->second].block();
+
+                for (size_t i = _instances.size(); i-- > 0;) {
+                    const LevelInstance& instance = _instances[i];
+                    if (!instance.contains(c)) continue;
+
+                    const std::unordered_map<Coordinate3D, size_t>& prefab = index(*instance.prefab);
+                    auto it = prefab.find(c - instance.offset);
+                    if (it != prefab.end()) return &instance.prefab->blocks()[it->second].block();
+                }
+
+                return nullptr;
+            }
+
+            /**
+             * Visits every block in the level without copying them: the blocks of each instance in order, then the level's own blocks.
+             * Blocks hidden by overlaps are visited too, before the blocks that hide them.
+             * @param visit The function to call with the block and its coordinate for each block.
+             */
+            template <typename F>
+            void forEach(F&& visit) const {
+                for (const LevelInstance& instance : _instances)
+                    for (const LevelObject& o : instance.prefab->blocks())
+                        visit(o.block(), o.coordinate3D() + instance.offset);
+
+                for (const LevelObject& o : _blocks)
+                    visit(o.block(), o.coordinate3D());
+            }
+
+            /**
+             * Copies the blocks of every instance into a single level, keeping only the visible block at each coordinate.
+             * @return A Level2D or Level3D with the headers of this level.
+             */
+            Level flatten() const {
+                std::vector<LevelObject> objects;
+                objects.reserve(size());
+
+                const bool is2D = _is2D;
+                forEach([&objects, is2D](const Block& block, const Coordinate3D& c) {
+                    if (is2D)
+                        objects.push_back(LevelObject(block, Coordinate2D(c.x, c.y)));
+                    else
+                        objects.push_back(LevelObject(block, c));
+                });
+
+                deduplicate(objects);
+
+                if (_is2D) return Level2D(_headers, objects);
+                return Level3D(_headers, objects);
+            }
+    };
+
+}
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <exception>
+#include <algorithm>
+#include <stdexcept>
+
+#include "coordinate.hpp"
+#include "block.hpp"
+#include "level.hpp"
+#include "world.hpp"
+
+namespace LevelZ {
+
+    /**
+     * A ray cast through the cells of a world.
+     */
+    struct Ray {
+        public:
+            /**
+             * The point the ray starts at.
+             */
+            Coordinate3D origin;
+
+            /**
+             * The direction of the ray, which does not need to be normalized.
+             */
+            Coordinate3D direction;
+
+            /**
+             * The distance after which the ray stops, measured along the normalized direction.
+             */
+            double maxDistance;
+
+            /**
+             * Constructs a new ray.
+             * @param origin The point the ray starts at.
+             * @param direction The direction of the ray.
+             * @param maxDistance The distance after which the ray stops.
+             */
+            Ray(Coordinate3D origin, Coordinate3D direction, double maxDistance = 1024.0) : origin(origin), direction(direction), maxDistance(maxDistance) {}
+    };
+
+    /**
+     * The result of casting a ray.
+     */
+    struct RayHit {
+        public:
+            /**
+             * The block that was hit, or nullptr if the ray hit nothing. Valid as long as the world that was cast into.
+             */
+            const Block* block = nullptr;
+
+            /**
+             * The cell that was hit.
+             */
+            Coordinate3D coordinate = Coordinate3D(0.0, 0.0, 0.0);
+
+            /**
+             * The outward normal of the face of the cell that the ray entered through, or zero if the ray started inside the cell.
+             */
+            Coordinate3D normal = Coordinate3D(0.0, 0.0, 0.0);
+
+            /**
+             * The distance from the origin of the ray to the point where it entered the cell.
+             */
+            double distance = 0;
+
+            /**
+             * Gets whether the ray hit a block.
+             * @return true if a block was hit, false otherwise
+             */
+            inline bool hit() const {
+                return block != nullptr;
+            }
+
+            /**
+             * Gets whether the ray hit a block.
+             * @return true if a block was hit, false otherwise
+             */
+            explicit operator bool() const {
+                return hit();
+            }
+    };
+
+    /**
+     * Casts rays through the cells of a 3D world, visiting only the cells each ray passes through.
+     *
+     * Rays are traversed with the grid DDA of Amanatides and Woo over the occupancy of a ChunkedWorld3D, so the cost of a ray
+     * grows with the number of cells it crosses rather than with the number of blocks in the level. Blocks occupy the unit cell
+     * containing their coordinate. Casting is read-only, so a raycaster can be shared between threads.
+     */
+    struct Raycaster {
+        private:
+            ChunkedWorld3D _world;
+
+            // the DDA traversal, optionally ignoring any block in the cell the ray starts in
+            RayHit trace(const Ray& ray, bool skipOrigin) const {
+                const double length = std::sqrt(ray.direction.getMagnitude());
+                if (!(length > 0) || !std::isfinite(length)) throw std::invalid_argument("Ray direction must be non-zero and finite");
+                if (!(ray.maxDistance >= 0) || !std::isfinite(ray.maxDistance)) throw std::invalid_argument("Ray distance must be non-negative and finite");
+
+                const double origin[3] = {ray.origin.x, ray.origin.y, ray.origin.z};
+                const double direction[3] = {ray.direction.x / length, ray.direction.y / length, ray.direction.z / length};
+                constexpr double infinity = std::numeric_limits<double>::infinity();
+
+                int cell[3], step[3];
+                double next[3], delta[3];
+                for (int axis = 0; axis < 3; axis++) {
+                    cell[axis] = static_cast<int>(std::floor(origin[axis]));
+
+                    if (direction[axis] > 0) {
+                        step[axis] = 1;
+                        delta[axis] = 1 / direction[axis];
+                        next[axis] = (cell[axis] + 1 - origin[axis]) * delta[axis];
+                    } else if (direction[axis] < 0) {
+                        step[axis] = -1;
+                        delta[axis] = -1 / direction[axis];
+                        next[axis] = (origin[axis] - cell[axis]) * delta[axis];
+                    } else {
+                        step[axis] = 0;
+                        delta[axis] = infinity;
+                        next[axis] = infinity;
+                    }
+                }
+
+                RayHit hit;
+                int face = -1;
+                double distance = 0;
+                while (true) {
+                    const Block* block = face < 0 && skipOrigin ? nullptr : _world.get(cell[0], cell[1], cell[2]);
+                    if (block != nullptr) {
+                        hit.block = block;
+                        hit.coordinate = Coordinate3D(static_cast<double>(cell[0]), static_cast<double>(cell[1]), static_cast<double>(cell[2]));
+                        hit.distance = distance;
+
+                        if (face >= 0) {
+                            double normal[3] = {0.0, 0.0, 0.0};
+                            normal[face] = -step[face];
+                            hit.normal = Coordinate3D(normal[0], normal[1], normal[2]);
+                        }
+
+                        return hit;
+                    }
+
+                    // step into the neighbouring cell whose boundary the ray crosses first
+                    face = next[0] < next[1] ? (next[0] < next[2] ? 0 : 2) : (next[1] < next[2] ? 1 : 2);
+                    if (next[face] > ray.maxDistance) return hit;
+
+                    distance = next[face];
+                    cell[face] += step[face];
+                    next[face] += delta[face];
+                }
+            }
+
+        public:
+            /**
+             * Constructs a raycaster over the blocks of a level.
+             * @param level The level to cast rays into.
+             */
+            explicit Raycaster(const Level& level) : _world(level) {}
+
+            /**
+             * Constructs a raycaster over a world.
+             * @param world The world to cast rays into.
+             */
+            explicit Raycaster(ChunkedWorld3D world) : _world(std::move(world)) {}
+
+            /**
+             * Gets the world that rays are cast into.
+             * @return The world of the raycaster.
+             */
+            inline const ChunkedWorld3D& world() const {
+                return _world;
+            }
+
+            /**
+             * Finds the first block along a ray, including a block in the cell the ray starts in.
+             * @param ray The ray to cast.
+             * @return The first block hit, or an empty hit if the ray reaches its maximum distance first.
+             * @throws std::invalid_argument if the direction is zero or the maximum distance is negative or not finite.
+             */
+            RayHit cast(const Ray& ray) const {
+                return trace(ray, false);
+            }
+
+            /**
+             * Finds the first block along a ray.
+             * @param origin The point the ray starts at.
+             * @param direction The direction of the ray.
+             * @param maxDistance The distance after which the ray stops.
+             * @return The first block hit, or an empty hit if the ray reaches its maximum distance first.
+             * @throws std::invalid_argument if the direction is zero or the maximum distance is negative or not finite.
+             */
+            RayHit cast(const Coordinate3D& origin, const Coordinate3D& direction, double maxDistance = 1024.0) const {
+                return cast(Ray(origin, direction, maxDistance));
+            }
+
+            /**
+             * Casts many rays, splitting them between threads.
+             * @param rays The rays to cast.
+             * @param threads The number of threads to cast with, or 0 for the number of hardware threads. Small batches use one thread.
+             * @return The hit of each ray, in the order of the rays.
+             * @throws std::invalid_argument if any ray is invalid.
+             */
+            std::vector<RayHit> cast(const std::vector<Ray>& rays, size_t threads = 0) const {
+                std::vector<RayHit> hits(rays.size());
+                if (threads == 0) threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+                threads = std::min(threads, (rays.size() + 255) / 256);
+
+                if (threads <= 1) {
+                    for (size_t i = 0; i < rays.size(); i++)
+                        hits[i] = cast(rays[i]);
+
+                    return hits;
+                }
+
+                const size_t slice = (rays.size() + threads - 1) / threads;
+                std::vector<std::exception_ptr> errors(threads);
+                auto task = [&](size_t t) {
+                    try {
+                        for (size_t i = t * slice, end = std::min(rays.size(), i + slice); i < end; i++)
+                            hits[i] = cast(rays[i]);
+                    } catch (...) {
+                        errors[t] = std::current_exception();
+                    }
+                };
+
+                std::vector<std::thread> pool;
+                for (size_t t = 1; t < threads; t++)
+                    pool.emplace_back(task, t);
+
+                task(0);
+                for (std::thread& thread : pool) thread.join();
+
+                for (const std::exception_ptr& error : errors)
+                    if (error) std::rethrow_exception(error);
+
+                return hits;
+            }
+
+            /**
+             * Checks whether the line between two points is clear of blocks. The cells containing the two points are not checked.
+             * @param from The first point.
+             * @param to The second point.
+             * @return true if no block lies between the points, false otherwise
+             */
+            bool visible(const Coordinate3D& from, const Coordinate3D& to) const {
+                const Coordinate3D target = Coordinate3D(std::floor(to.x), std::floor(to.y), std::floor(to.z));
+                const Coordinate3D start = Coordinate3D(std::floor(from.x), std::floor(from.y), std::floor(from.z));
+                if (start == target) return true;
+
+                const Coordinate3D direction = to - from;
+                RayHit hit = trace(Ray(from, direction, std::sqrt(direction.getMagnitude())), true);
+                return !hit || hit.coordinate == target;
+            }
+    };
+
+}
@@ -0,0 +1,327 @@
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <future>
+#include <utility>
+#include <stdexcept>
+#include <filesystem>
+#include <unordered_map>
+
+#include "../levelz.hpp"
+#include "cache.hpp"
+
+namespace LevelZ {
+
+    /**
+     * Estimates the memory used by a level, including its headers, blocks and their properties.
+     * @param level The level to measure.
+     * @return The approximate number of bytes.
+     */
+    inline size_t estimateMemory(const Level& level) {
+        // approximate node overhead of the standard unordered_map and std::string implementations
+        const size_t node = 2 * sizeof(void*) + 2 * sizeof(std::string);
+        auto string = [](const std::string& s) {
+            return s.capacity() > 15 ? s.capacity() + 1 : 0;
+        };
+
+        size_t total = sizeof(Level2D) > sizeof(Level3D) ? sizeof(Level2D) : sizeof(Level3D);
+
+        total += level.headers().bucket_count() * sizeof(void*);
+        for (auto const& [k, v] : level.headers())
+            total += node + string(k) + string(v);
+
+        total += level.blocks().capacity() * sizeof(LevelObject);
+        for (const LevelObject& o : level.blocks()) {
+            const Block& block = o.block();
+            total += string(block.name);
+            if (block.properties.empty()) continue;
+
+            total += block.properties.bucket_count() * sizeof(void*);
+            for (auto const& [k, v] : block.properties)
+                total += node + string(k) + string(v);
+        }
+
+        return total;
+    }
+
+    /**
+     * Options for a LevelRegistry.
+     */
+    struct RegistryOptions {
+        /**
+         * The approximate number of bytes of levels to keep loaded before evicting the least recently used ones.
+         */
+        size_t budget = 256 * 1024 * 1024;
+
+        /**
+         * Whether to check the modification time of a file on each lookup, reloading it if it changed.
+         */
+        bool watch = true;
+
+        /**
+         * The options to parse levels with. Any memory resource must outlive the registry and every level it returned.
+         */
+        ParseOptions parse;
+
+        /**
+         * A persistent cache to load levels through, or nullptr to parse them directly. It must outlive the registry.
+         */
+        LevelCache* cache = nullptr;
+    };
+
+    /**
+     * A thread-safe registry of immutable, shared levels, loaded on demand.
+     *
+     * Concurrent requests for the same file share a single load. Loaded levels are kept in least recently used order
+     * within a memory budget; evicted levels stay alive for as long as callers hold them.
+     */
+    struct LevelRegistry {
+        private:
+            struct Entry {
+                std::shared_future<std::shared_ptr<const Level>> level;
+                std::filesystem::file_time_type modified;
+                std::list<std::string>::iterator position;
+                size_t bytes = 0;
+                size_t id = 0;
+                bool ready = false;
+            };
+
+            RegistryOptions _options;
+            mutable std::mutex _mutex;
+            std::unordered_map<std::string, Entry> _entries;
+            std::list<std::string> _order;
+            size_t _memory = 0;
+            size_t _hits = 0;
+            size_t _misses = 0;
+            size_t _evictions = 0;
+            size_t _loads = 0;
+
+            static std::filesystem::file_time_type modified(const std::string& path) {
+                std::error_code error;
+                std::filesystem::file_time_type time = std::filesystem::last_write_time(path, error);
+                return error ? std::filesystem::file_time_type::min() : time;
+            }
+
+            void erase(std::unordered_map<std::string, Entry>::iterator it) {
+                if (it->second.ready) _memory -= it->second.bytes;
+                _order.erase(it->second.position);
+                _entries.erase(it);
+            }
+
+            void evict(const std::string& keep) {
+                auto it = _order.end();
+                while (_memory > _options.budget && it != _order.begin()) {
+                    --it;
+                    auto entry = _entries.find(*it);
+                    if (!entry->second.ready || *it == keep) continue;
+
+                    auto next = std::next(it);
+                    erase(entry);
+                    _evictions++;
+                    it = next;
+                }
+            }
+
+            std::shared_ptr<const Level> load(const std::string& path) {
+                if (!std::filesystem::is_regular_file(path)) throw std::invalid_argument("Level file not found: " + path);
+
+                return share(_options.cache != nullptr ? _options.cache->load(path, _options.parse) : parseFile(path, _options.parse));
+            }
+
+        public:
+            /**
+             * Constructs a new registry.
+             * @param options The options of the registry.
+             */
+            explicit LevelRegistry(const RegistryOptions& options = RegistryOptions()) : _options(options) {}
+
+            LevelRegistry(const LevelRegistry&) = delete;
+            LevelRegistry& operator=(const LevelRegistry&) = delete;
+
+            /**
+             * Gets a level, loading it if it is not loaded or its file changed.
+             * @param path The file of the level.
+             * @return The shared level, which is a Level2D or Level3D depending on its type.
+             * @throws std::invalid_argument if the file cannot be read.
+             * @throws std::out_of_range if the file is not a valid level.
+             */
+            std::shared_ptr<const Level> get(const std::string& path) {
+                std::unique_lock<std::mutex> lock(_mutex);
+
+                auto it = _entries.find(path);
+                if (it != _entries.end() && it->second.ready && _options.watch && modified(path) != it->second.modified) {
+                    erase(it);
+                    it = _entries.end();
+                }
+
+                if (it != _entries.end()) {
+                    _hits++;
+                    _order.splice(_order.begin(), _order, it->second.position);
+                    std::shared_future<std::shared_ptr<const Level>> future = it->second.level;
+                    lock.unlock();
+
+                    return future.get();
+                }
+
+                _misses++;
+                std::promise<std::shared_ptr<const Level>> promise;
+                Entry& entry = _entries[path];
+                const size_t id = ++_loads;
+                entry.id = id;
+                entry.level = promise.get_future().share();
+                entry.modified = _options.watch ? modified(path) : std::filesystem::file_time_type();
+                _order.push_front(path);
+                entry.position = _order.begin();
+                std::shared_future<std::shared_ptr<const Level>> future = entry.level;
+                lock.unlock();
+
+                std::shared_ptr<const Level> level;
+                try {
+                    level = load(path);
+                } catch (...) {
+                    lock.lock();
+                    auto failed = _entries.find(path);
+                    if (failed != _entries.end() && failed->second.id == id) erase(failed);
+                    lock.unlock();
+
+                    promise.set_exception(std::current_exception());
+                    return future.get();
+                }
+
+                size_t bytes = estimateMemory(*level);
+
+                lock.lock();
+                auto loaded = _entries.find(path);
+                if (loaded != _entries.end() && loaded->second.id == id) {
+                    loaded->second.ready = true;
+                    loaded->second.bytes = bytes;
+                    _memory += bytes;
+                    evict(path);
+                }
+                lock.unlock();
+
+                promise.set_value(level);
+                return level;
+            }
+
+            /**
+             * Gets a 2D level, loading it if necessary.
+             * @param path The file of the level.
+             * @return The shared level.
+             * @throws std::invalid_argument if the level is not 2D.
+             */
+            std::shared_ptr<const Level2D> get2D(const std::string& path) {
+                std::shared_ptr<const Level> level = get(path);
+                if (level->headers().at("type") == "3") throw std::invalid_argument("Level is not 2D: " + path);
+
+                return std::static_pointer_cast<const Level2D>(level);
+            }
+
+            /**
+             * Gets a 3D level, loading it if necessary.
+             * @param path The file of the level.
+             * @return The shared level.
+             * @throws std::invalid_argument if the level is not 3D.
+             */
+            std::shared_ptr<const Level3D> get3D(const std::string& path) {
+                std::shared_ptr<const Level> level = get(path);
+                if (level->headers().at("type") != "3") throw std::invalid_argument("Level is not 3D: " + path);
+
+                return std::static_pointer_cast<const Level3D>(level);
+            }
+
+            /**
+             * Removes a level, so the next lookup loads it again.
+             * @param path The file of the level.
+             * @return true if the level was loaded, false otherwise
+             */
+            bool invalidate(const std::string& path) {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                auto it = _entries.find(path);
+                if (it == _entries.end() || !it->second.ready) return false;
+
+                erase(it);
+                return true;
+            }
+
+            /**
+             * Removes every loaded level.
+             */
+            void clear() {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                for (auto it = _entries.begin(); it != _entries.end();) {
+                    auto next = std::next(it);
+                    if (it->second.ready) erase(it);
+                    it = next;
+                }
+            }
+
+            /**
+             * Gets whether a level is loaded.
+             * @param path The file of the level.
+             * @return true if the level is loaded, false otherwise
+             */
+            bool contains(const std::string& path) const {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                auto it = _entries.find(path);
+                return it != _entries.end() && it->second.ready;
+            }
+
+            /**
+             * Gets the number of loaded levels.
+             * @return The number of levels.
+             */
+            size_t size() const {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                size_t count = 0;
+                for (auto const& [path, entry] : _entries)
+                    if (entry.ready) count++;
+
+                return count;
+            }
+
+            /**
+             * Gets the estimated memory used by the loaded levels.
+             * @return The approximate number of bytes.
+             */
+            size_t memory() const {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _memory;
+            }
+
+            /**
+             * Gets the number of lookups served by a loaded or loading level.
+             * @return The number of hits.
+             */
+            size_t hits() const {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _hits;
+            }
+
+            /**
+             * Gets the number of lookups that loaded a level.
+             * @return The number of misses.
+             */
+            size_t misses() const {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _misses;
+            }
+
+            /**
+             * Gets the number of levels evicted to stay within the memory budget.
+             * @return The number of evictions.
+             */
+            size_t evictions() const {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _evictions;
+            }
+    };
+
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+
+#include "level.hpp"
+#include "diff.hpp"
+
+namespace LevelZ {
+
+    /**
+     * A level that many threads can read while others edit it.
+     *
+     * Readers take an immutable snapshot, which stays valid and unchanged for as long as they hold it.
+     * Editors build a new level from the latest snapshot and publish it with a single atomic pointer swap,
+     * so readers never wait for an edit to finish. Edits are serialized, so concurrent edits are never lost.
+     */
+    struct SharedLevel {
+        private:
+#if __cplusplus >= 202002L && defined(__cpp_lib_atomic_shared_ptr)
+            std::atomic<std::shared_ptr<const Level>> _current;
+
+            std::shared_ptr<const Level> load() const {
+                return _current.load(std::memory_order_acquire);
+            }
+
+            void store(std::shared_ptr<const Level> level) {
+                _current.store(std::move(level), std::memory_order_release);
+            }
+#else
+            std::shared_ptr<const Level> _current;
+
+            std::shared_ptr<const Level> load() const {
+                return std::atomic_load_explicit(&_current, std::memory_order_acquire);
+            }
+
+            void store(std::shared_ptr<const Level> level) {
+                std::atomic_store_explicit(&_current, std::move(level), std::memory_order_release);
+            }
+#endif
+            std::mutex _edit;
+            std::atomic<uint64_t> _version{0};
+
+            std::shared_ptr<const Level> publish(std::shared_ptr<const Level> level) {
+                store(level);
+                _version.fetch_add(1, std::memory_order_acq_rel);
+                return level;
+            }
+
+        public:
+            /**
+             * Constructs a new shared level.
+             * @param level The initial contents of the level.
+             */
+            explicit SharedLevel(Level level) {
+                store(share(std::move(level)));
+            }
+
+            SharedLevel(const SharedLevel&) = delete;
+            SharedLevel& operator=(const SharedLevel&) = delete;
+
+            /**
+             * Gets the current contents of the level. Never blocks on editors.
+             * @return An immutable snapshot of the level, as a Level2D or Level3D.
+             */
+            std::shared_ptr<const Level> snapshot() const {
+                return load();
+            }
+
+            /**
+             * Gets the current contents of a 2D level.
+             * @return An immutable snapshot of the level.
+             * @throws std::invalid_argument if the level is 3D.
+             */
+            std::shared_ptr<const Level2D> snapshot2D() const {
+                std::shared_ptr<const Level> level = load();
+                if (level->headers().at("type") == "3") throw std::invalid_argument("Level is not 2D");
+
+                return std::static_pointer_cast<const Level2D>(level);
+            }
+
+            /**
+             * Gets the current contents of a 3D level.
+             * @return An immutable snapshot of the level.
+             * @throws std::invalid_argument if the level is 2D.
+             */
+            std::shared_ptr<const Level3D> snapshot3D() const {
+                std::shared_ptr<const Level> level = load();
+                if (level->headers().at("type") != "3") throw std::invalid_argument("Level is not 3D");
+
+                return std::static_pointer_cast<const Level3D>(level);
+            }
+
+            /**
+             * Gets the number of edits published since the level was created.
+             * @return The version of the level.
+             */
+            uint64_t version() const {
+                return _version.load(std::memory_order_acquire);
+            }
+
+            /**
+             * Replaces the contents of the level.
+             * @param level The new contents of the level.
+             * @return The published snapshot.
+             */
+            std::shared_ptr<const Level> replace(Level level) {
+                std::shared_ptr<const Level> shared = share(std::move(level));
+
+                std::lock_guard<std::mutex> lock(_edit);
+                return publish(std::move(shared));
+            }
+
+            /**
+             * Applies a batch of changes to the latest contents of the level and publishes the result.
+             * @param diff The changes to apply, as with patch.
+             * @return The published snapshot.
+             */
+            std::shared_ptr<const Level> apply(const LevelDiff& diff) {
+                std::lock_guard<std::mutex> lock(_edit);
+                return publish(share(patch(*load(), diff)));
+            }
+
+            /**
+             * Builds new contents from the latest contents of the level and publishes them.
+             * Other edits wait until the function returns, so it should not take long.
+             * @param edit A function receiving the latest snapshot and returning the new contents.
+             * @return The published snapshot.
+             */
+            template <typename F>
+            std::shared_ptr<const Level> update(F&& edit) {
+                std::lock_guard<std::mutex> lock(_edit);
+
+                std::shared_ptr<const Level> current = load();
+                return publish(share(Level(edit(*current))));
+            }
+    };
+
+}
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <vector>
+#include <thread>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+#include <algorithm>
+#include <unordered_map>
+
+#include "coordinate.hpp"
+#include "block.hpp"
+#include "level.hpp"
+
+namespace LevelZ {
+
+    /**
+     * Interleaves the bits of two coordinates into a Morton (Z-order) code.
+     * @param x The x coordinate.
+     * @param y The y coordinate.
+     * @return The Morton code, with the bits of x in the even positions.
+     */
+    inline uint64_t mortonEncode2D(uint32_t x, uint32_t y) {
+        auto spread = [](uint64_t v) {
+            v = (v | (v << 16)) & 0x0000FFFF0000FFFFULL;
+            v = (v | (v << 8)) & 0x00FF00FF00FF00FFULL;
+            v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+            v = (v | (v << 2)) & 0x3333333333333333ULL;
+            v = (v | (v << 1)) & 0x5555555555555555ULL;
+            return v;
+        };
+
+        return spread(x) | (spread(y) << 1);
+    }
+
+    /**
+     * Interleaves the bits of three coordinates into a Morton (Z-order) code. Only the low 21 bits of each coordinate are used.
+     * @param x The x coordinate.
+     * @param y The y coordinate.
+     * @param z The z coordinate.
+     * @return The Morton code, with the bits of x in every third position from 0.
+     */
+    inline uint64_t mortonEncode3D(uint32_t x, uint32_t y, uint32_t z) {
+        auto spread = [](uint64_t v) {
+            v &= 0x1FFFFF;
+            v = (v | (v << 32)) & 0x001F00000000FFFFULL;
+            v = (v | (v << 16)) & 0x001F0000FF0000FFULL;
+            v = (v | (v << 8)) & 0x100F00F00F00F00FULL;
+            v = (v | (v << 4)) & 0x10C30C30C30C30C3ULL;
+            v = (v | (v << 2)) & 0x1249249249249249ULL;
+            return v;
+        };
+
+        return spread(x) | (spread(y) << 1) | (spread(z) << 2);
+    }
+
+    /**
+     * Sorts keys and their values together with a stable least significant digit radix sort.
+     *
+     * Each pass counts digits and scatters in parallel over separate slices of the keys. Passes over bytes that are the same
+     * in every key are skipped, so small keys sort in fewer passes.
+     * @param keys The keys to sort.
+     * @param values The values to reorder with the keys, of the same size.
+     * @param threads The number of threads to use, or 0 for the number of hardware threads. Small inputs use one thread.
+     */
+    inline void radixSort(std::vector<uint64_t>& keys, std::vector<size_t>& values, size_t threads = 0) {
+        const size_t n = keys.size();
+        if (threads == 0) threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        if (n < 65536) threads = 1;
+
+        uint64_t bits = 0;
+        for (uint64_t key : keys) bits |= key;
+
+        std::vector<uint64_t> keyBuffer(n);
+        std::vector<size_t> valueBuffer(n);
+        std::vector<std::array<size_t, 256>> offsets(threads);
+        const size_t slice = (n + threads - 1) / threads;
+
+        auto run = [threads](const auto& task) {
+            std::vector<std::thread> pool;
+            for (size_t t = 1; t < threads; t++)
+                pool.emplace_back(task, t);
+
+            task(0);
+            for (std::thread& thread : pool) thread.join();
+        };
+
+        for (int shift = 0; shift < 64 && (bits >> shift) != 0; shift += 8) {
+            run([&](size_t t) {
+                offsets[t].fill(0);
+                for (size_t i = t * slice, end = std::min(n, i + slice); i < end; i++)
+                    offsets[t][(keys[i] >> shift) & 0xFF]++;
+            });
+
+            // every thread scatters its slice after the same digit from earlier slices, keeping the sort stable
+            bool constant = false;
+            size_t position = 0;
+            for (size_t digit = 0; digit < 256; digit++) {
+                size_t start = position;
+                for (size_t t = 0; t < threads; t++) {
+                    size_t count = offsets[t][digit];
+                    offsets[t][digit] = position;
+                    position += count;
+                }
+
+                if (position - start == n) constant = true;
+            }
+
+            if (constant) continue;
+
+            run([&](size_t t) {
+                std::array<size_t, 256>& offset = offsets[t];
+                for (size_t i = t * slice, end = std::min(n, i + slice); i < end; i++) {
+                    size_t p = offset[(keys[i] >> shift) & 0xFF]++;
+                    keyBuffer[p] = keys[i];
+                    valueBuffer[p] = values[i];
+                }
+            });
+
+            keys.swap(keyBuffer);
+            values.swap(valueBuffer);
+        }
+    }
+
+    /**
+     * The size of the cells that sortMorton groups blocks into, in coordinate units along each axis.
+     */
+    const uint32_t MORTON_CELL = 16;
+
+    /**
+     * Reorders blocks along a Morton (Z-order) curve of their coordinates, so blocks near each other in space are near each other in memory.
+     *
+     * Space is divided into cells of MORTON_CELL units along each axis, which are visited in Morton order. Within a cell, blocks are grouped
+     * by block, in order of first appearance, and then follow the Morton order of their coordinates, so each cell holds long runs of the same
+     * block for blockRuns. Coordinates are measured in whole units from the minimum corner of the blocks. Different blocks at the same
+     * coordinate may change order, so deduplicate the blocks before sorting them, as the parser does.
+     * @param blocks The blocks to sort, in a std::vector or BlockList.
+     * @param threads The number of threads to sort with, or 0 for the number of hardware threads.
+     */
+    template <typename Blocks, typename = std::enable_if_t<!std::is_base_of_v<Level, Blocks>>>
+    inline void sortMorton(Blocks& blocks, size_t threads = 0) {
+        const size_t n = blocks.size();
+        if (n < 2) return;
+
+        bool is2D = true;
+        Coordinate3D origin = blocks[0].coordinate3D();
+        for (const LevelObject& o : blocks) {
+            const Coordinate3D& c = o.coordinate3D();
+            origin = Coordinate3D(std::min(origin.x, c.x), std::min(origin.y, c.y), std::min(origin.z, c.z));
+            if (!o.is2D()) is2D = false;
+        }
+
+        auto quantize = [](double value, double origin, uint32_t limit) {
+            double d = std::floor(value - origin);
+            if (!(d > 0)) return uint32_t(0);
+            return d >= limit ? limit : static_cast<uint32_t>(d);
+        };
+
+        const uint32_t limit = is2D ? UINT32_MAX : 0x1FFFFF * MORTON_CELL;
+        auto encode = [is2D](uint32_t x, uint32_t y, uint32_t z) {
+            return is2D ? mortonEncode2D(x, y) : mortonEncode3D(x, y, z);
+        };
+
+        std::vector<uint64_t> cells(n);
+        std::vector<uint64_t> ids(n);
+        std::vector<uint64_t> keys(n);
+        std::vector<size_t> order(n);
+
+        std::unordered_map<Block, uint64_t> index;
+        for (size_t i = 0; i < n; i++) {
+            const Coordinate3D& c = blocks[i].coordinate3D();
+            uint32_t x = quantize(c.x, origin.x, limit), y = quantize(c.y, origin.y, limit), z = quantize(c.z, origin.z, limit);
+
+            cells[i] = encode(x / MORTON_CELL, y / MORTON_CELL, z / MORTON_CELL);
+            keys[i] = encode(x % MORTON_CELL, y % MORTON_CELL, z % MORTON_CELL);
+            order[i] = i;
+
+            // consecutive blocks are usually the same, which avoids hashing their properties
+            if (i > 0 && blocks[i].block() == blocks[i - 1].block())
+                ids[i] = ids[i - 1];
+            else
+                ids[i] = index.emplace(blocks[i].block(), index.size()).first->second;
+        }
+
+        // stable passes from the least to the most significant key: position in the cell, block, then cell
+        radixSort(keys, order, threads);
+
+        for (size_t i = 0; i < n; i++) keys[i] = ids[order[i]];
+        radixSort(keys, order, threads);
+
+        for (size_t i = 0; i < n; i++) keys[i] = cells[order[i]];
+        radixSort(keys, order, threads);
+
+        Blocks sorted(blocks.get_allocator());
+        sorted.reserve(n);
+        for (size_t i : order)
+            sorted.push_back(std::move(blocks[i]));
+
+        blocks.swap(sorted);
+    }
+
+    /**
+     * Reorders the blocks of a level along a Morton (Z-order) curve of their coordinates.
+     * The headers, statistics and fingerprint of the level are unchanged.
+     * @param level The level to sort.
+     * @param threads The number of threads to sort with, or 0 for the number of hardware threads.
+     */
+    inline void sortMorton(Level& level, size_t threads = 0) {
+        sortMorton(level._blocks, threads);
+    }
+
+    /**
+     * A run of consecutive blocks that are the same block with the same number of dimensions.
+     */
+    struct BlockRun {
+        /**
+         * The index of the first block in the run.
+         */
+        size_t offset;
+
+        /**
+         * The number of blocks in the run.
+         */
+        size_t length;
+    };
+
+    /**
+     * Run-length encodes a list of blocks. Sorting the blocks first, such as with sortMorton, tends to make runs longer.
+     * @param blocks The blocks to encode, in a std::vector or BlockList.
+     * @return The runs of the blocks, in order, covering every block.
+     */
+    template <typename Blocks>
+    inline std::vector<BlockRun> blockRuns(const Blocks& blocks) {
+        std::vector<BlockRun> runs;
+
+        for (size_t i = 0; i < blocks.size();) {
+            size_t j = i + 1;
+            while (j < blocks.size() && blocks[j].is2D() == blocks[i].is2D() && blocks[j].block() == blocks[i].block()) j++;
+
+            runs.push_back(BlockRun{i, j - i});
+            i = j;
+        }
+
+        return runs;
+    }
+
+}
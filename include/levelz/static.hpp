@@ -0,0 +1,386 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+#include "../levelz.hpp"
+
+namespace LevelZ {
+
+    /**
+     * A block parsed at compile time, viewing its name and properties in the source text.
+     */
+    struct StaticBlock {
+        public:
+            /**
+             * The whole block, such as "grass<type=1>".
+             */
+            std::string_view text;
+
+            /**
+             * The name of the block.
+             */
+            std::string_view name;
+
+            /**
+             * The properties of the block without the angle brackets, such as "type=1", or empty.
+             */
+            std::string_view properties;
+
+            /**
+             * Parses a block, usable in constant expressions.
+             * @param str The block to parse.
+             * @return The parsed block.
+             */
+            static constexpr StaticBlock parse(std::string_view str) {
+                StaticBlock block;
+                block.text = trimView(str);
+
+                size_t open = block.text.find('<');
+                if (open == std::string_view::npos) {
+                    block.name = block.text;
+                    return block;
+                }
+
+                block.name = trimView(block.text.substr(0, open));
+                std::string_view rest = block.text.substr(open + 1);
+                size_t close = rest.rfind('>');
+                block.properties = trimView(close == std::string_view::npos ? rest : rest.substr(0, close));
+                return block;
+            }
+
+            /**
+             * Gets the value of a property, usable in constant expressions.
+             * @param key The key of the property.
+             * @return The value of the property, or an empty view if the block does not have it.
+             */
+            constexpr std::string_view property(std::string_view key) const {
+                std::string_view rest = properties;
+                while (!rest.empty()) {
+                    size_t comma = rest.find(',');
+                    std::string_view entry = rest.substr(0, comma);
+                    rest = comma == std::string_view::npos ? std::string_view() : rest.substr(comma + 1);
+
+                    size_t equals = entry.find('=');
+                    if (equals != std::string_view::npos && trimView(entry.substr(0, equals)) == key)
+                        return trimView(entry.substr(equals + 1));
+                }
+
+                return std::string_view();
+            }
+
+            constexpr bool operator==(const StaticBlock& other) const {
+                return text == other.text;
+            }
+
+            constexpr bool operator!=(const StaticBlock& other) const {
+                return text != other.text;
+            }
+    };
+
+    /**
+     * A header parsed at compile time.
+     */
+    struct StaticHeader {
+        /**
+         * The key of the header.
+         */
+        std::string_view key;
+
+        /**
+         * The value of the header.
+         */
+        std::string_view value;
+    };
+
+    /**
+     * A block placed at a coordinate, parsed at compile time.
+     */
+    struct StaticObject {
+        /**
+         * The block.
+         */
+        StaticBlock block;
+
+        /**
+         * The coordinate of the block. The z coordinate of 2D objects is 0.
+         */
+        Coordinate3D coordinate;
+    };
+
+    /**
+     * Reads the headers and objects of a level in a constant expression, passing them to a sink.
+     * @param contents The contents of the level.
+     * @param sink An object with constexpr header(key, value) and object(block, coordinate) members.
+     * @return true if the level is 2D, false if it is 3D
+     * @throws std::invalid_argument if the level is malformed.
+     */
+    template <typename Sink>
+    constexpr bool readStatic(std::string_view contents, Sink& sink) {
+        bool body = false;
+        bool typed = false;
+        bool is2D = true;
+
+        while (!contents.empty()) {
+            size_t newline = contents.find('\n');
+            std::string_view line = contents.substr(0, newline);
+            contents = newline == std::string_view::npos ? std::string_view() : contents.substr(newline + 1);
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+            if (!body) {
+                if (line == "---") {
+                    if (!typed) throw std::invalid_argument("Level is missing its type header");
+                    body = true;
+                    continue;
+                }
+
+                if (line.empty() || line[0] != '@') throw std::invalid_argument("Invalid header");
+
+                size_t space = line.find(' ');
+                std::string_view key = trimView(line.substr(1, space == std::string_view::npos ? space : space - 1));
+                std::string_view value = space == std::string_view::npos ? std::string_view() : trimView(line.substr(space));
+                if (key == "type") {
+                    typed = true;
+                    is2D = value == "2";
+                }
+
+                sink.header(key, value);
+                continue;
+            }
+
+            if (!line.empty() && line[0] == '#') continue;
+            if (line == "end") break;
+
+            line = trimView(line.substr(0, line.find('#')));
+            if (line.empty()) continue;
+
+            size_t colon = line.find(':');
+            if (colon == std::string_view::npos) throw std::invalid_argument("Expected ':' in line");
+
+            const StaticBlock block = StaticBlock::parse(line.substr(0, colon));
+            std::string_view points = line.substr(colon + 1);
+
+            while (!points.empty()) {
+                size_t star = points.find('*');
+                std::string_view point = trimView(points.substr(0, star));
+                points = star == std::string_view::npos ? std::string_view() : points.substr(star + 1);
+                if (point.empty()) continue;
+
+                if (point.front() == '(' && point.back() == ']') {
+                    if (is2D) {
+                        const CoordinateMatrix2D m = CoordinateMatrix2D::parse(point);
+                        for (int x = m.minX; x <= m.maxX; x++)
+                            for (int y = m.minY; y <= m.maxY; y++)
+                                sink.object(block, Coordinate3D(m.start.x + x, m.start.y + y, 0.0));
+                    } else {
+                        const CoordinateMatrix3D m = CoordinateMatrix3D::parse(point);
+                        for (int x = m.minX; x <= m.maxX; x++)
+                            for (int y = m.minY; y <= m.maxY; y++)
+                                for (int z = m.minZ; z <= m.maxZ; z++)
+                                    sink.object(block, Coordinate3D(m.start.x + x, m.start.y + y, m.start.z + z));
+                    }
+                } else if (is2D) {
+                    const Coordinate2D c = Coordinate2D::parse(point);
+                    sink.object(block, Coordinate3D(c.x, c.y, 0.0));
+                } else
+                    sink.object(block, Coordinate3D::parse(point));
+            }
+        }
+
+        if (!body) throw std::invalid_argument("Level is missing the end of its header section");
+        return is2D;
+    }
+
+    /**
+     * Counts the objects in a level, usable in constant expressions to size a StaticLevel.
+     * @param contents The contents of the level.
+     * @return The number of objects, including those expanded from matrices.
+     */
+    constexpr size_t countObjects(std::string_view contents) {
+        struct Counter {
+            size_t objects = 0;
+            constexpr void header(std::string_view, std::string_view) {}
+            constexpr void object(const StaticBlock&, const Coordinate3D&) { objects++; }
+        } counter;
+
+        readStatic(contents, counter);
+        return counter.objects;
+    }
+
+    /**
+     * Counts the headers in a level, usable in constant expressions to size a StaticLevel.
+     * @param contents The contents of the level.
+     * @return The number of headers.
+     */
+    constexpr size_t countHeaders(std::string_view contents) {
+        struct Counter {
+            size_t headers = 0;
+            constexpr void header(std::string_view, std::string_view) { headers++; }
+            constexpr void object(const StaticBlock&, const Coordinate3D&) {}
+        } counter;
+
+        readStatic(contents, counter);
+        return counter.headers;
+    }
+
+    /**
+     * A level parsed at compile time into fixed-size arrays, viewing the names and values in its source text.
+     * The source text must outlive the level, as string literals do.
+     * @tparam N The number of objects, from countObjects.
+     * @tparam H The maximum number of headers.
+     */
+    template <size_t N, size_t H = 8>
+    struct StaticLevel {
+        public:
+            /**
+             * The headers of the level, in source order.
+             */
+            std::array<StaticHeader, H> headers = {};
+
+            /**
+             * The number of headers.
+             */
+            size_t headerCount = 0;
+
+            /**
+             * The objects of the level, in source order.
+             */
+            std::array<StaticObject, N> objects = {};
+
+            /**
+             * The number of objects.
+             */
+            size_t count = 0;
+
+            /**
+             * Whether the level is 2D.
+             */
+            bool is2D = true;
+
+            constexpr void header(std::string_view key, std::string_view value) {
+                if (headerCount == H) throw std::invalid_argument("Too many headers for StaticLevel");
+                headers[headerCount++] = StaticHeader{key, value};
+            }
+
+            constexpr void object(const StaticBlock& block, const Coordinate3D& coordinate) {
+                if (count == N) throw std::invalid_argument("Too many objects for StaticLevel");
+                objects[count++] = StaticObject{block, coordinate};
+            }
+
+            /**
+             * Gets the value of a header.
+             * @param key The key of the header.
+             * @return The value of the header, or an empty view if the level does not have it.
+             */
+            constexpr std::string_view header(std::string_view key) const {
+                for (size_t i = 0; i < headerCount; i++)
+                    if (headers[i].key == key) return headers[i].value;
+
+                return std::string_view();
+            }
+
+            /**
+             * Gets the number of objects.
+             * @return The number of objects.
+             */
+            constexpr size_t size() const {
+                return count;
+            }
+
+            /**
+             * Gets an object.
+             * @param index The index of the object.
+             * @return The object.
+             */
+            constexpr const StaticObject& operator[](size_t index) const {
+                return objects[index];
+            }
+
+            /**
+             * Gets the spawnpoint of the level.
+             * @return The spawnpoint, with a z coordinate of 0 in 2D levels.
+             */
+            constexpr Coordinate3D spawn() const {
+                std::string_view value = header("spawn");
+                if (value.empty()) return Coordinate3D(0.0, 0.0, 0.0);
+                if (!is2D) return Coordinate3D::parse(value);
+
+                const Coordinate2D c = Coordinate2D::parse(value);
+                return Coordinate3D(c.x, c.y, 0.0);
+            }
+
+            /**
+             * Builds a runtime level with the same headers and blocks, equal to parsing the same source.
+             * @return The level.
+             */
+            Level toLevel() const {
+                std::vector<std::string> lines;
+                for (size_t i = 0; i < headerCount; i++)
+                    lines.push_back("@" + std::string(headers[i].key) + " " + std::string(headers[i].value));
+
+                std::unordered_map<std::string_view, Block> blocks;
+                BlockList result;
+                result.reserve(count);
+
+                for (size_t i = 0; i < count; i++) {
+                    const StaticObject& o = objects[i];
+                    auto it = blocks.find(o.block.text);
+                    if (it == blocks.end()) it = blocks.emplace(o.block.text, readBlock(o.block.text)).first;
+
+                    if (is2D)
+                        result.push_back(LevelObject(it->second, Coordinate2D(o.coordinate.x, o.coordinate.y)));
+                    else
+                        result.push_back(LevelObject(it->second, o.coordinate));
+                }
+
+                return createLevel(readLevelHeaders(lines.begin(), lines.end()), std::move(result));
+            }
+    };
+
+    /**
+     * Parses a level into fixed-size arrays, usable in constant expressions.
+     * @tparam N The number of objects, from countObjects.
+     * @tparam H The maximum number of headers.
+     * @param contents The contents of the level, which must outlive the result.
+     * @return The parsed level.
+     * @throws std::invalid_argument if the level is malformed or does not fit.
+     */
+    template <size_t N, size_t H = 8>
+    constexpr StaticLevel<N, H> parseStatic(std::string_view contents) {
+        StaticLevel<N, H> level;
+        level.is2D = readStatic(contents, level);
+        return level;
+    }
+
+#if __cplusplus >= 202002L
+
+    /**
+     * A string literal usable as a template argument. Requires C++20.
+     * @tparam L The length of the literal, including the null terminator.
+     */
+    template <size_t L>
+    struct FixedString {
+        char data[L] = {};
+
+        constexpr FixedString(const char (&str)[L]) {
+            for (size_t i = 0; i < L; i++) data[i] = str[i];
+        }
+
+        constexpr std::string_view view() const {
+            return std::string_view(data, L - 1);
+        }
+    };
+
+    /**
+     * A level parsed at compile time from a string literal, such as static_level<"@type 2\n---\ngrass: [0, 0]">. Requires C++20.
+     */
+    template <FixedString S>
+    inline constexpr auto static_level = parseStatic<countObjects(S.view()), countHeaders(S.view())>(S.view());
+
+#endif
+
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <string>
+#include <algorithm>
+#include <unordered_map>
+
+#include "coordinate.hpp"
+#include "block.hpp"
+#include "matrix.hpp"
+
+namespace LevelZ {
+
+    /**
+     * A summary of the blocks in a level: their bounding box, how many there are of each block, and how they were placed.
+     *
+     * The parser fills it in while reading the level, counting matrices from their ranges without expanding them.
+     */
+    struct LevelStats {
+        private:
+            void include(const Coordinate3D& low, const Coordinate3D& high, size_t cells) {
+                if (cells == 0) return;
+
+                if (total == 0) {
+                    min = low;
+                    max = high;
+                } else {
+                    min = Coordinate3D(std::min(min.x, low.x), std::min(min.y, low.y), std::min(min.z, low.z));
+                    max = Coordinate3D(std::max(max.x, high.x), std::max(max.y, high.y), std::max(max.z, high.z));
+                }
+
+                total += cells;
+            }
+
+        public:
+            /**
+             * The number of blocks in the level.
+             */
+            size_t total = 0;
+
+            /**
+             * The number of blocks placed at single coordinates.
+             */
+            size_t points = 0;
+
+            /**
+             * The number of coordinate matrices in the level.
+             */
+            size_t matrices = 0;
+
+            /**
+             * The number of blocks placed by coordinate matrices.
+             */
+            size_t matrixCells = 0;
+
+            /**
+             * The number of blocks with each block name.
+             */
+            std::unordered_map<std::string, size_t> counts;
+
+            /**
+             * The minimum corner of the bounding box of the blocks. The z coordinate is 0 in 2D levels.
+             */
+            Coordinate3D min = Coordinate3D(0.0, 0.0, 0.0);
+
+            /**
+             * The maximum corner of the bounding box of the blocks. The z coordinate is 0 in 2D levels.
+             */
+            Coordinate3D max = Coordinate3D(0.0, 0.0, 0.0);
+
+            /**
+             * Gets whether the level has no blocks.
+             * @return true if there are no blocks, false otherwise
+             */
+            inline bool empty() const {
+                return total == 0;
+            }
+
+            /**
+             * Gets the number of blocks with a block name.
+             * @param name The name of the block.
+             * @return The number of blocks.
+             */
+            size_t count(const std::string& name) const {
+                auto it = counts.find(name);
+                return it == counts.end() ? 0 : it->second;
+            }
+
+            /**
+             * Gets the size of the bounding box of the blocks.
+             * @return The distance between the minimum and maximum corners.
+             */
+            inline Coordinate3D extent() const {
+                return max - min;
+            }
+
+            /**
+             * Adds a block placed at a single 2D coordinate, without counting its name.
+             * @param c The coordinate of the block.
+             */
+            void add(const Coordinate2D& c) {
+                add(Coordinate3D(c.x, c.y, 0.0));
+            }
+
+            /**
+             * Adds a block placed at a single 3D coordinate, without counting its name.
+             * @param c The coordinate of the block.
+             */
+            void add(const Coordinate3D& c) {
+                include(c, c, 1);
+                points++;
+            }
+
+            /**
+             * Adds the blocks placed by a 2D matrix, without counting their name or expanding the matrix.
+             * @param m The matrix of the blocks.
+             */
+            void add(const CoordinateMatrix2D& m) {
+                include(Coordinate3D(m.start.x + m.minX, m.start.y + m.minY, 0.0), Coordinate3D(m.start.x + m.maxX, m.start.y + m.maxY, 0.0), m.size());
+                matrices++;
+                matrixCells += m.size();
+            }
+
+            /**
+             * Adds the blocks placed by a 3D matrix, without counting their name or expanding the matrix.
+             * @param m The matrix of the blocks.
+             */
+            void add(const CoordinateMatrix3D& m) {
+                include(
+                    Coordinate3D(m.start.x + m.minX, m.start.y + m.minY, m.start.z + m.minZ),
+                    Coordinate3D(m.start.x + m.maxX, m.start.y + m.maxY, m.start.z + m.maxZ),
+                    m.size()
+                );
+                matrices++;
+                matrixCells += m.size();
+            }
+
+            /**
+             * Adds a block and counts its name.
+             * @param o The block to add.
+             */
+            void add(const LevelObject& o) {
+                add(o.coordinate3D());
+                counts[o.block().name]++;
+            }
+
+            /**
+             * Computes the statistics of a list of blocks by scanning them. Every block counts as a point.
+             * @param blocks The blocks to summarize, in a std::vector or BlockList.
+             * @return The statistics of the blocks.
+             */
+            template <typename Blocks>
+            static LevelStats of(const Blocks& blocks) {
+                LevelStats stats;
+                for (const LevelObject& o : blocks)
+                    stats.add(o);
+
+                return stats;
+            }
+    };
+
+}
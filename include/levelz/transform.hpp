@@ -0,0 +1,378 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LEVELZ_SSE2 1
+#endif
+
+#include "coordinate.hpp"
+
+namespace LevelZ {
+
+    /**
+     * Represents an axis in 3D space.
+     */
+    enum class Axis {
+        /**
+         * The X axis
+         */
+        X,
+
+        /**
+         * The Y axis
+         */
+        Y,
+
+        /**
+         * The Z axis
+         */
+        Z
+    };
+
+    /**
+     * Represents the bounding box of a set of 2D coordinates.
+     */
+    struct Bounds2D {
+        /**
+         * The minimum coordinate of the bounds.
+         */
+        Coordinate2D min;
+
+        /**
+         * The maximum coordinate of the bounds.
+         */
+        Coordinate2D max;
+    };
+
+    /**
+     * Represents the bounding box of a set of 3D coordinates.
+     */
+    struct Bounds3D {
+        /**
+         * The minimum coordinate of the bounds.
+         */
+        Coordinate3D min;
+
+        /**
+         * The maximum coordinate of the bounds.
+         */
+        Coordinate3D max;
+    };
+
+    /**
+     * Translates each coordinate by an offset.
+     * @param coordinates The coordinates to translate.
+     * @param count The number of coordinates.
+     * @param offset The offset to add to each coordinate.
+     */
+    inline void translate(Coordinate2D* coordinates, size_t count, const Coordinate2D& offset) {
+        double* p = reinterpret_cast<double*>(coordinates);
+#ifdef LEVELZ_SSE2
+        const __m128d o = _mm_set_pd(offset.y, offset.x);
+        for (size_t i = 0; i < count; i++, p += 2)
+            _mm_storeu_pd(p, _mm_add_pd(_mm_loadu_pd(p), o));
+#else
+        for (size_t i = 0; i < count; i++, p += 2) {
+            p[0] += offset.x;
+            p[1] += offset.y;
+        }
+#endif
+    }
+
+    /**
+     * Translates each coordinate by an offset.
+     * @param coordinates The coordinates to translate.
+     * @param count The number of coordinates.
+     * @param offset The offset to add to each coordinate.
+     */
+    inline void translate(Coordinate3D* coordinates, size_t count, const Coordinate3D& offset) {
+        double* p = reinterpret_cast<double*>(coordinates);
+        size_t i = 0;
+#ifdef LEVELZ_SSE2
+        // two coordinates span three registers: (x, y), (z, x), (y, z)
+        const __m128d o0 = _mm_set_pd(offset.y, offset.x);
+        const __m128d o1 = _mm_set_pd(offset.x, offset.z);
+        const __m128d o2 = _mm_set_pd(offset.z, offset.y);
+        for (; i + 2 <= count; i += 2, p += 6) {
+            _mm_storeu_pd(p, _mm_add_pd(_mm_loadu_pd(p), o0));
+            _mm_storeu_pd(p + 2, _mm_add_pd(_mm_loadu_pd(p + 2), o1));
+            _mm_storeu_pd(p + 4, _mm_add_pd(_mm_loadu_pd(p + 4), o2));
+        }
+#endif
+        for (; i < count; i++, p += 3) {
+            p[0] += offset.x;
+            p[1] += offset.y;
+            p[2] += offset.z;
+        }
+    }
+
+    /**
+     * Scales each coordinate component-wise. Negative factors mirror the coordinates along that axis.
+     * @param coordinates The coordinates to scale.
+     * @param count The number of coordinates.
+     * @param factors The factor to multiply each component by.
+     */
+    inline void scale(Coordinate2D* coordinates, size_t count, const Coordinate2D& factors) {
+        double* p = reinterpret_cast<double*>(coordinates);
+#ifdef LEVELZ_SSE2
+        const __m128d f = _mm_set_pd(factors.y, factors.x);
+        for (size_t i = 0; i < count; i++, p += 2)
+            _mm_storeu_pd(p, _mm_mul_pd(_mm_loadu_pd(p), f));
+#else
+        for (size_t i = 0; i < count; i++, p += 2) {
+            p[0] *= factors.x;
+            p[1] *= factors.y;
+        }
+#endif
+    }
+
+    /**
+     * Scales each coordinate component-wise. Negative factors mirror the coordinates along that axis.
+     * @param coordinates The coordinates to scale.
+     * @param count The number of coordinates.
+     * @param factors The factor to multiply each component by.
+     */
+    inline void scale(Coordinate3D* coordinates, size_t count, const Coordinate3D& factors) {
+        double* p = reinterpret_cast<double*>(coordinates);
+        size_t i = 0;
+#ifdef LEVELZ_SSE2
+        const __m128d f0 = _mm_set_pd(factors.y, factors.x);
+        const __m128d f1 = _mm_set_pd(factors.x, factors.z);
+        const __m128d f2 = _mm_set_pd(factors.z, factors.y);
+        for (; i + 2 <= count; i += 2, p += 6) {
+            _mm_storeu_pd(p, _mm_mul_pd(_mm_loadu_pd(p), f0));
+            _mm_storeu_pd(p + 2, _mm_mul_pd(_mm_loadu_pd(p + 2), f1));
+            _mm_storeu_pd(p + 4, _mm_mul_pd(_mm_loadu_pd(p + 4), f2));
+        }
+#endif
+        for (; i < count; i++, p += 3) {
+            p[0] *= factors.x;
+            p[1] *= factors.y;
+            p[2] *= factors.z;
+        }
+    }
+
+    /**
+     * Rotates each coordinate counter-clockwise around the origin in steps of 90 degrees.
+     * @param coordinates The coordinates to rotate.
+     * @param count The number of coordinates.
+     * @param turns The number of quarter turns. Negative values rotate clockwise.
+     */
+    inline void rotate90(Coordinate2D* coordinates, size_t count, int turns) {
+        turns = ((turns % 4) + 4) % 4;
+        if (turns == 0) return;
+
+        double* p = reinterpret_cast<double*>(coordinates);
+#ifdef LEVELZ_SSE2
+        // quarter turns swap the components, then flip the sign of one (or, for half turns, both) of them
+        const __m128d sign = turns == 1 ? _mm_set_pd(0.0, -0.0) : turns == 2 ? _mm_set_pd(-0.0, -0.0) : _mm_set_pd(-0.0, 0.0);
+        if (turns == 2) {
+            for (size_t i = 0; i < count; i++, p += 2)
+                _mm_storeu_pd(p, _mm_xor_pd(_mm_loadu_pd(p), sign));
+        } else {
+            for (size_t i = 0; i < count; i++, p += 2) {
+                __m128d v = _mm_loadu_pd(p);
+                _mm_storeu_pd(p, _mm_xor_pd(_mm_shuffle_pd(v, v, 1), sign));
+            }
+        }
+#else
+        for (size_t i = 0; i < count; i++, p += 2) {
+            double x = p[0], y = p[1];
+            switch (turns) {
+                case 1: p[0] = -y; p[1] = x; break;
+                case 2: p[0] = -x; p[1] = -y; break;
+                case 3: p[0] = y; p[1] = -x; break;
+            }
+        }
+#endif
+    }
+
+    /**
+     * Rotates each coordinate counter-clockwise around an axis in steps of 90 degrees.
+     * @param coordinates The coordinates to rotate.
+     * @param count The number of coordinates.
+     * @param axis The axis to rotate around.
+     * @param turns The number of quarter turns. Negative values rotate clockwise.
+     */
+    inline void rotate90(Coordinate3D* coordinates, size_t count, Axis axis, int turns) {
+        turns = ((turns % 4) + 4) % 4;
+        if (turns == 0) return;
+
+        // the rotated plane, in right-handed order: (y, z) around X, (z, x) around Y, (x, y) around Z
+        const int a = axis == Axis::X ? 1 : axis == Axis::Y ? 2 : 0;
+        const int b = axis == Axis::X ? 2 : axis == Axis::Y ? 0 : 1;
+
+        double* p = reinterpret_cast<double*>(coordinates);
+        for (size_t i = 0; i < count; i++, p += 3) {
+            double u = p[a], v = p[b];
+            switch (turns) {
+                case 1: p[a] = -v; p[b] = u; break;
+                case 2: p[a] = -u; p[b] = -v; break;
+                case 3: p[a] = v; p[b] = -u; break;
+            }
+        }
+    }
+
+    /**
+     * Computes the bounding box of the coordinates.
+     * @param coordinates The coordinates to bound.
+     * @param count The number of coordinates.
+     * @return The bounding box, or an empty box at the origin if there are no coordinates.
+     */
+    inline Bounds2D bounds(const Coordinate2D* coordinates, size_t count) {
+        if (count == 0) return Bounds2D();
+
+        const double* p = reinterpret_cast<const double*>(coordinates);
+#ifdef LEVELZ_SSE2
+        __m128d mn = _mm_loadu_pd(p);
+        __m128d mx = mn;
+        for (size_t i = 1; i < count; i++) {
+            __m128d v = _mm_loadu_pd(p + 2 * i);
+            mn = _mm_min_pd(mn, v);
+            mx = _mm_max_pd(mx, v);
+        }
+
+        double lo[2], hi[2];
+        _mm_storeu_pd(lo, mn);
+        _mm_storeu_pd(hi, mx);
+        return Bounds2D{Coordinate2D(lo[0], lo[1]), Coordinate2D(hi[0], hi[1])};
+#else
+        Bounds2D b{coordinates[0], coordinates[0]};
+        for (size_t i = 1; i < count; i++, p += 2) {
+            b.min.x = std::min(b.min.x, coordinates[i].x);
+            b.min.y = std::min(b.min.y, coordinates[i].y);
+            b.max.x = std::max(b.max.x, coordinates[i].x);
+            b.max.y = std::max(b.max.y, coordinates[i].y);
+        }
+        return b;
+#endif
+    }
+
+    /**
+     * Computes the bounding box of the coordinates.
+     * @param coordinates The coordinates to bound.
+     * @param count The number of coordinates.
+     * @return The bounding box, or an empty box at the origin if there are no coordinates.
+     */
+    inline Bounds3D bounds(const Coordinate3D* coordinates, size_t count) {
+        if (count == 0) return Bounds3D();
+
+        Bounds3D b{coordinates[0], coordinates[0]};
+        size_t i = 0;
+#ifdef LEVELZ_SSE2
+        if (count >= 2) {
+            const double* p = reinterpret_cast<const double*>(coordinates);
+            __m128d mn0 = _mm_loadu_pd(p), mn1 = _mm_loadu_pd(p + 2), mn2 = _mm_loadu_pd(p + 4);
+            __m128d mx0 = mn0, mx1 = mn1, mx2 = mn2;
+            for (i = 2; i + 2 <= count; i += 2) {
+                const double* q = p + 3 * i;
+                __m128d v0 = _mm_loadu_pd(q), v1 = _mm_loadu_pd(q + 2), v2 = _mm_loadu_pd(q + 4);
+                mn0 = _mm_min_pd(mn0, v0); mx0 = _mm_max_pd(mx0, v0);
+                mn1 = _mm_min_pd(mn1, v1); mx1 = _mm_max_pd(mx1, v1);
+                mn2 = _mm_min_pd(mn2, v2); mx2 = _mm_max_pd(mx2, v2);
+            }
+
+            // lanes hold (x, y), (z, x), (y, z)
+            double lo[6], hi[6];
+            _mm_storeu_pd(lo, mn0); _mm_storeu_pd(lo + 2, mn1); _mm_storeu_pd(lo + 4, mn2);
+            _mm_storeu_pd(hi, mx0); _mm_storeu_pd(hi + 2, mx1); _mm_storeu_pd(hi + 4, mx2);
+            b.min = Coordinate3D(std::min(lo[0], lo[3]), std::min(lo[1], lo[4]), std::min(lo[2], lo[5]));
+            b.max = Coordinate3D(std::max(hi[0], hi[3]), std::max(hi[1], hi[4]), std::max(hi[2], hi[5]));
+        }
+#endif
+        for (; i < count; i++) {
+            const Coordinate3D& c = coordinates[i];
+            b.min = Coordinate3D(std::min(b.min.x, c.x), std::min(b.min.y, c.y), std::min(b.min.z, c.z));
+            b.max = Coordinate3D(std::max(b.max.x, c.x), std::max(b.max.y, c.y), std::max(b.max.z, c.z));
+        }
+        return b;
+    }
+
+    /**
+     * Computes the magnitude of each coordinate, as returned by Coordinate2D::getMagnitude.
+     * @param coordinates The coordinates to measure.
+     * @param count The number of coordinates.
+     * @param out The array to write the magnitudes to, with room for count values.
+     */
+    inline void magnitudes(const Coordinate2D* coordinates, size_t count, double* out) {
+        const double* p = reinterpret_cast<const double*>(coordinates);
+        size_t i = 0;
+#ifdef LEVELZ_SSE2
+        for (; i + 2 <= count; i += 2) {
+            __m128d a = _mm_loadu_pd(p + 2 * i);
+            __m128d b = _mm_loadu_pd(p + 2 * i + 2);
+            a = _mm_mul_pd(a, a);
+            b = _mm_mul_pd(b, b);
+            _mm_storeu_pd(out + i, _mm_add_pd(_mm_unpacklo_pd(a, b), _mm_unpackhi_pd(a, b)));
+        }
+#endif
+        for (; i < count; i++)
+            out[i] = p[2 * i] * p[2 * i] + p[2 * i + 1] * p[2 * i + 1];
+    }
+
+    /**
+     * Computes the magnitude of each coordinate, as returned by Coordinate3D::getMagnitude.
+     * @param coordinates The coordinates to measure.
+     * @param count The number of coordinates.
+     * @param out The array to write the magnitudes to, with room for count values.
+     */
+    inline void magnitudes(const Coordinate3D* coordinates, size_t count, double* out) {
+        for (size_t i = 0; i < count; i++)
+            out[i] = coordinates[i].x * coordinates[i].x + coordinates[i].y * coordinates[i].y + coordinates[i].z * coordinates[i].z;
+    }
+
+    /**
+     * Translates each coordinate by an offset.
+     * @param coordinates The coordinates to translate.
+     * @param offset The offset to add to each coordinate.
+     */
+    template <typename C>
+    inline void translate(std::vector<C>& coordinates, const C& offset) {
+        translate(coordinates.data(), coordinates.size(), offset);
+    }
+
+    /**
+     * Scales each coordinate component-wise.
+     * @param coordinates The coordinates to scale.
+     * @param factors The factor to multiply each component by.
+     */
+    template <typename C>
+    inline void scale(std::vector<C>& coordinates, const C& factors) {
+        scale(coordinates.data(), coordinates.size(), factors);
+    }
+
+    /**
+     * Computes the bounding box of the coordinates.
+     * @param coordinates The coordinates to bound.
+     * @return The bounding box.
+     */
+    inline Bounds2D bounds(const std::vector<Coordinate2D>& coordinates) {
+        return bounds(coordinates.data(), coordinates.size());
+    }
+
+    /**
+     * Computes the bounding box of the coordinates.
+     * @param coordinates The coordinates to bound.
+     * @return The bounding box.
+     */
+    inline Bounds3D bounds(const std::vector<Coordinate3D>& coordinates) {
+        return bounds(coordinates.data(), coordinates.size());
+    }
+
+    /**
+     * Computes the magnitude of each coordinate.
+     * @param coordinates The coordinates to measure.
+     * @return The magnitudes, in the same order as the coordinates.
+     */
+    template <typename C>
+    inline std::vector<double> magnitudes(const std::vector<C>& coordinates) {
+        std::vector<double> out(coordinates.size());
+        magnitudes(coordinates.data(), coordinates.size(), out.data());
+        return out;
+    }
+
+}
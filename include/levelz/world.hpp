@@ -0,0 +1,418 @@
+#pragma once
+
+#include <cmath>
+#include <array>
+#include <deque>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <unordered_map>
+
+#include "coordinate.hpp"
+#include "block.hpp"
+#include "matrix.hpp"
+#include "level.hpp"
+
+namespace LevelZ {
+
+    /**
+     * A 3D world of blocks stored in fixed-size cubic sections, for keeping large worlds in memory.
+     *
+     * Each section covers SECTION_SIZE cells along each axis and stores a palette of the blocks it contains together with one
+     * bit-packed palette index per cell, using as few bits as the size of its palette needs. Sections are only created for chunks
+     * that contain blocks and are removed once they are empty. Each distinct block is stored once for the whole world.
+     *
+     * Cells have integer coordinates; blocks at fractional coordinates are placed in the cell containing them. Chunk coordinates
+     * must fit in 21 signed bits, which allows cell coordinates within about ±16 million.
+     */
+    struct ChunkedWorld3D {
+        public:
+            /**
+             * The number of cells along each axis of a section.
+             */
+            static constexpr int SECTION_SIZE = 16;
+
+            /**
+             * The number of cells in a section.
+             */
+            static constexpr size_t SECTION_CELLS = SECTION_SIZE * SECTION_SIZE * SECTION_SIZE;
+
+        private:
+            struct Section {
+                int x, y, z;
+
+                // world block ids, where the first entry is always 0 for empty cells
+                std::vector<uint32_t> palette{0};
+                std::vector<uint64_t> data;
+                uint8_t bits = 0;
+                uint32_t count = 0;
+
+                uint32_t get(size_t cell) const {
+                    if (bits == 0) return 0;
+
+                    const size_t perWord = 64 / bits;
+                    return static_cast<uint32_t>((data[cell / perWord] >> ((cell % perWord) * bits)) & ((uint64_t(1) << bits) - 1));
+                }
+
+                void put(size_t cell, uint32_t index) {
+                    const size_t perWord = 64 / bits;
+                    const size_t shift = (cell % perWord) * bits;
+                    uint64_t& word = data[cell / perWord];
+                    word = (word & ~(((uint64_t(1) << bits) - 1) << shift)) | (static_cast<uint64_t>(index) << shift);
+                }
+
+                void repack(uint8_t size, const std::vector<uint32_t>& remap) {
+                    Section packed;
+                    packed.bits = size;
+                    if (size > 0) packed.data.assign((SECTION_CELLS + 64 / size - 1) / (64 / size), 0);
+
+                    if (size > 0 && bits > 0)
+                        for (size_t cell = 0; cell < SECTION_CELLS; cell++)
+                            packed.put(cell, remap[get(cell)]);
+
+                    data = std::move(packed.data);
+                    bits = size;
+                }
+
+                // the palette index of a world block id, adding it and widening the indices if needed
+                uint32_t index(uint32_t id) {
+                    for (size_t i = 0; i < palette.size(); i++)
+                        if (palette[i] == id) return static_cast<uint32_t>(i);
+
+                    palette.push_back(id);
+                    if (palette.size() > (size_t(1) << bits)) {
+                        std::vector<uint32_t> identity(palette.size());
+                        for (size_t i = 0; i < identity.size(); i++) identity[i] = static_cast<uint32_t>(i);
+
+                        repack(static_cast<uint8_t>(bits + 1), identity);
+                    }
+
+                    return static_cast<uint32_t>(palette.size() - 1);
+                }
+
+                // sets a cell, returning the change in the number of non-empty cells
+                int set(size_t cell, uint32_t index) {
+                    uint32_t old = get(cell);
+                    if (old == index) return 0;
+
+                    put(cell, index);
+                    return (old == 0 ? 1 : 0) - (index == 0 ? 1 : 0);
+                }
+
+                void compact() {
+                    std::vector<bool> used(palette.size(), false);
+                    used[0] = true;
+                    for (size_t cell = 0; cell < SECTION_CELLS; cell++)
+                        used[get(cell)] = true;
+
+                    std::vector<uint32_t> remap(palette.size(), 0);
+                    std::vector<uint32_t> compacted;
+                    for (size_t i = 0; i < palette.size(); i++)
+                        if (used[i]) {
+                            remap[i] = static_cast<uint32_t>(compacted.size());
+                            compacted.push_back(palette[i]);
+                        }
+
+                    uint8_t size = 0;
+                    while ((size_t(1) << size) < compacted.size()) size++;
+
+                    if (compacted.size() == palette.size() && size == bits) return;
+
+                    repack(size, remap);
+                    palette = std::move(compacted);
+                }
+
+                size_t memory() const {
+                    return sizeof(Section) + palette.capacity() * sizeof(uint32_t) + data.capacity() * sizeof(uint64_t);
+                }
+            };
+
+            std::unordered_map<uint64_t, Section> _sections;
+            std::deque<Block> _blocks;
+            std::unordered_map<Block, uint32_t> _ids;
+            size_t _size = 0;
+
+            static int floorDiv(int value) {
+                return value >= 0 ? value / SECTION_SIZE : -((-value + SECTION_SIZE - 1) / SECTION_SIZE);
+            }
+
+            static size_t cell(int x, int y, int z) {
+                const int lx = x - floorDiv(x) * SECTION_SIZE;
+                const int ly = y - floorDiv(y) * SECTION_SIZE;
+                const int lz = z - floorDiv(z) * SECTION_SIZE;
+                return (static_cast<size_t>(ly) * SECTION_SIZE + static_cast<size_t>(lz)) * SECTION_SIZE + static_cast<size_t>(lx);
+            }
+
+            static uint64_t key(int cx, int cy, int cz) {
+                return (static_cast<uint64_t>(cx & 0x1FFFFF) << 42) | (static_cast<uint64_t>(cy & 0x1FFFFF) << 21) | static_cast<uint64_t>(cz & 0x1FFFFF);
+            }
+
+            static int toCell(double value) {
+                return static_cast<int>(std::floor(value));
+            }
+
+            uint32_t id(const Block& block) {
+                auto it = _ids.find(block);
+                if (it != _ids.end()) return it->second;
+
+                _blocks.push_back(block);
+                return _ids.emplace(block, static_cast<uint32_t>(_blocks.size())).first->second;
+            }
+
+            Section* find(int cx, int cy, int cz) {
+                auto it = _sections.find(key(cx, cy, cz));
+                return it == _sections.end() ? nullptr : &it->second;
+            }
+
+            const Section* find(int cx, int cy, int cz) const {
+                auto it = _sections.find(key(cx, cy, cz));
+                return it == _sections.end() ? nullptr : &it->second;
+            }
+
+            Section& section(int cx, int cy, int cz) {
+                auto [it, inserted] = _sections.try_emplace(key(cx, cy, cz));
+                if (inserted) {
+                    it->second.x = cx;
+                    it->second.y = cy;
+                    it->second.z = cz;
+                }
+
+                return it->second;
+            }
+
+            void update(Section& s, int delta) {
+                s.count = static_cast<uint32_t>(static_cast<int64_t>(s.count) + delta);
+                _size = static_cast<size_t>(static_cast<int64_t>(_size) + delta);
+
+                if (s.count == 0) _sections.erase(key(s.x, s.y, s.z));
+            }
+
+            void fill(const CoordinateMatrix3D& matrix, const Block* block) {
+                if (matrix.size() == 0) return;
+
+                const int x0 = toCell(matrix.start.x) + matrix.minX, x1 = toCell(matrix.start.x) + matrix.maxX;
+                const int y0 = toCell(matrix.start.y) + matrix.minY, y1 = toCell(matrix.start.y) + matrix.maxY;
+                const int z0 = toCell(matrix.start.z) + matrix.minZ, z1 = toCell(matrix.start.z) + matrix.maxZ;
+                const uint32_t global = block != nullptr ? id(*block) : 0;
+
+                for (int cx = floorDiv(x0); cx <= floorDiv(x1); cx++)
+                    for (int cy = floorDiv(y0); cy <= floorDiv(y1); cy++)
+                        for (int cz = floorDiv(z0); cz <= floorDiv(z1); cz++) {
+                            Section* s = block != nullptr ? &section(cx, cy, cz) : find(cx, cy, cz);
+                            if (s == nullptr) continue;
+
+                            const uint32_t index = s->index(global);
+                            int delta = 0;
+
+                            const int bx = cx * SECTION_SIZE, by = cy * SECTION_SIZE, bz = cz * SECTION_SIZE;
+                            for (int y = std::max(y0, by); y <= std::min(y1, by + SECTION_SIZE - 1); y++)
+                                for (int z = std::max(z0, bz); z <= std::min(z1, bz + SECTION_SIZE - 1); z++)
+                                    for (int x = std::max(x0, bx); x <= std::min(x1, bx + SECTION_SIZE - 1); x++)
+                                        delta += s->set(cell(x, y, z), index);
+
+                            update(*s, delta);
+                        }
+            }
+
+        public:
+            /**
+             * Constructs an empty world.
+             */
+            ChunkedWorld3D() = default;
+
+            /**
+             * Constructs a world from the blocks of a level. Later blocks replace earlier blocks in the same cell.
+             * @param level The level to read the blocks from.
+             */
+            explicit ChunkedWorld3D(const Level& level) {
+                for (const LevelObject& o : level.blocks())
+                    set(o.coordinate3D(), o.block());
+            }
+
+            /**
+             * Gets the block in a cell.
+             * @param x The x coordinate of the cell.
+             * @param y The y coordinate of the cell.
+             * @param z The z coordinate of the cell.
+             * @return The block, or nullptr if the cell is empty. Valid until the world is destroyed.
+             */
+            const Block* get(int x, int y, int z) const {
+                const Section* s = find(floorDiv(x), floorDiv(y), floorDiv(z));
+                if (s == nullptr) return nullptr;
+
+                uint32_t global = s->palette[s->get(cell(x, y, z))];
+                return global == 0 ? nullptr : &_blocks[global - 1];
+            }
+
+            /**
+             * Gets the identifier of the block in a cell, which is one more than the index of the block in the palette.
+             * @param x The x coordinate of the cell.
+             * @param y The y coordinate of the cell.
+             * @param z The z coordinate of the cell.
+             * @return The identifier of the block, or 0 if the cell is empty.
+             */
+            uint32_t blockId(int x, int y, int z) const {
+                const Section* s = find(floorDiv(x), floorDiv(y), floorDiv(z));
+                return s == nullptr ? 0 : s->palette[s->get(cell(x, y, z))];
+            }
+
+            /**
+             * Gets the block in the cell containing a coordinate.
+             * @param c The coordinate.
+             * @return The block, or nullptr if the cell is empty.
+             */
+            const Block* get(const Coordinate3D& c) const {
+                return get(toCell(c.x), toCell(c.y), toCell(c.z));
+            }
+
+            /**
+             * Places a block in a cell, replacing any block already there.
+             * @param x The x coordinate of the cell.
+             * @param y The y coordinate of the cell.
+             * @param z The z coordinate of the cell.
+             * @param block The block to place.
+             */
+            void set(int x, int y, int z, const Block& block) {
+                Section& s = section(floorDiv(x), floorDiv(y), floorDiv(z));
+                update(s, s.set(cell(x, y, z), s.index(id(block))));
+            }
+
+            /**
+             * Places a block in the cell containing a coordinate, replacing any block already there.
+             * @param c The coordinate.
+             * @param block The block to place.
+             */
+            void set(const Coordinate3D& c, const Block& block) {
+                set(toCell(c.x), toCell(c.y), toCell(c.z), block);
+            }
+
+            /**
+             * Empties a cell.
+             * @param x The x coordinate of the cell.
+             * @param y The y coordinate of the cell.
+             * @param z The z coordinate of the cell.
+             * @return true if the cell contained a block, false otherwise
+             */
+            bool erase(int x, int y, int z) {
+                Section* s = find(floorDiv(x), floorDiv(y), floorDiv(z));
+                if (s == nullptr) return false;
+
+                int delta = s->set(cell(x, y, z), 0);
+                update(*s, delta);
+                return delta != 0;
+            }
+
+            /**
+             * Places a block in every cell of a matrix, one section at a time.
+             * @param matrix The cells to fill.
+             * @param block The block to place.
+             */
+            void fill(const CoordinateMatrix3D& matrix, const Block& block) {
+                fill(matrix, &block);
+            }
+
+            /**
+             * Empties every cell of a matrix, one section at a time.
+             * @param matrix The cells to empty.
+             */
+            void erase(const CoordinateMatrix3D& matrix) {
+                fill(matrix, nullptr);
+            }
+
+            /**
+             * Gets the number of non-empty cells.
+             * @return The number of blocks in the world.
+             */
+            inline size_t size() const {
+                return _size;
+            }
+
+            /**
+             * Gets the number of sections, which is the number of chunks containing blocks.
+             * @return The number of sections.
+             */
+            inline size_t sections() const {
+                return _sections.size();
+            }
+
+            /**
+             * Gets the chunk coordinates of every section, which are the cell coordinates divided by SECTION_SIZE and rounded down.
+             * @return The coordinates of the sections, in no particular order.
+             */
+            std::vector<std::array<int, 3>> chunks() const {
+                std::vector<std::array<int, 3>> chunks;
+                chunks.reserve(_sections.size());
+                for (auto const& [k, s] : _sections)
+                    chunks.push_back({s.x, s.y, s.z});
+
+                return chunks;
+            }
+
+            /**
+             * Gets every distinct block ever placed in the world.
+             * @return The blocks of the world.
+             */
+            inline const std::deque<Block>& palette() const {
+                return _blocks;
+            }
+
+            /**
+             * Estimates the memory used by the sections of the world, excluding the blocks of the palette.
+             * @return The approximate number of bytes.
+             */
+            size_t memory() const {
+                size_t total = _sections.bucket_count() * sizeof(void*);
+                for (auto const& [k, s] : _sections)
+                    total += s.memory() + 2 * sizeof(void*);
+
+                return total;
+            }
+
+            /**
+             * Shrinks the palette of every section to the blocks it still contains, narrowing its indices where possible.
+             */
+            void compact() {
+                for (auto& [k, s] : _sections)
+                    s.compact();
+            }
+
+            /**
+             * Calls a function for every non-empty cell, one section at a time.
+             * @param visit A function receiving the x, y and z coordinates of the cell and its block.
+             */
+            template <typename F>
+            void forEach(F&& visit) const {
+                for (auto const& [k, s] : _sections) {
+                    const int bx = s.x * SECTION_SIZE, by = s.y * SECTION_SIZE, bz = s.z * SECTION_SIZE;
+
+                    for (size_t c = 0; c < SECTION_CELLS; c++) {
+                        uint32_t global = s.palette[s.get(c)];
+                        if (global == 0) continue;
+
+                        const int x = static_cast<int>(c % SECTION_SIZE);
+                        const int z = static_cast<int>((c / SECTION_SIZE) % SECTION_SIZE);
+                        const int y = static_cast<int>(c / (SECTION_SIZE * SECTION_SIZE));
+                        visit(bx + x, by + y, bz + z, _blocks[global - 1]);
+                    }
+                }
+            }
+
+            /**
+             * Builds a 3D level containing the blocks of the world.
+             * @param headers The headers of the level.
+             * @return The level.
+             */
+            Level3D toLevel(const std::unordered_map<std::string, std::string>& headers = {{"type", "3"}}) const {
+                std::vector<LevelObject> objects;
+                objects.reserve(_size);
+
+                forEach([&objects](int x, int y, int z, const Block& block) {
+                    objects.push_back(LevelObject(block, Coordinate3D(static_cast<double>(x), static_cast<double>(y), static_cast<double>(z))));
+                });
+
+                return Level3D(headers, objects);
+            }
+    };
+
+}
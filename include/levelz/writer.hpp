@@ -0,0 +1,253 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <cmath>
+#include <algorithm>
+#include <unordered_map>
+
+#include "coordinate.hpp"
+#include "block.hpp"
+#include "matrix.hpp"
+#include "level.hpp"
+
+namespace LevelZ {
+
+    /**
+     * Writes LevelZ files line by line to an output stream, without building the contents in memory.
+     */
+    struct LevelWriter {
+        private:
+            std::ostream& _out;
+            std::string _line;
+            size_t _bytes = 0;
+            size_t _lines = 0;
+
+            void flush() {
+                _line += '\n';
+                _out.write(_line.data(), static_cast<std::streamsize>(_line.size()));
+                _bytes += _line.size();
+                _lines++;
+                _line.clear();
+            }
+
+        public:
+            /**
+             * Constructs a new writer for the specified stream.
+             * @param out The stream to write to.
+             */
+            explicit LevelWriter(std::ostream& out) : _out(out) {}
+
+            /**
+             * Gets the number of bytes written.
+             * @return The number of bytes written.
+             */
+            inline size_t bytes() const {
+                return _bytes;
+            }
+
+            /**
+             * Gets the number of lines written.
+             * @return The number of lines written.
+             */
+            inline size_t lines() const {
+                return _lines;
+            }
+
+            /**
+             * Writes a header.
+             * @param key The key of the header.
+             * @param value The value of the header.
+             */
+            void header(const std::string& key, const std::string& value) {
+                _line += '@';
+                _line += key;
+                _line += ' ';
+                _line += value;
+                flush();
+            }
+
+            /**
+             * Writes the end of the header section.
+             */
+            void endHeaders() {
+                _line += "---";
+                flush();
+            }
+
+            /**
+             * Writes a comment line.
+             * @param text The text of the comment.
+             */
+            void comment(const std::string& text) {
+                _line += "# ";
+                _line += text;
+                flush();
+            }
+
+            /**
+             * Writes a line placing a block at each of the specified coordinates.
+             * @param block The block to place.
+             * @param points The coordinates to place the block at.
+             * @param comment An optional comment to append to the line.
+             */
+            template <typename C>
+            void points(const Block& block, const std::vector<C>& points, const std::string& comment = "") {
+                append(block);
+                _line += ": ";
+
+                for (size_t i = 0; i < points.size(); i++) {
+                    if (i > 0) _line += '*';
+                    append(points[i]);
+                }
+
+                appendComment(comment);
+                flush();
+            }
+
+            /**
+             * Writes a line filling a coordinate matrix with a block.
+             * @param block The block to place.
+             * @param matrix The matrix of coordinates to place the block at.
+             * @param comment An optional comment to append to the line.
+             */
+            template <typename M>
+            void matrix(const Block& block, const M& matrix, const std::string& comment = "") {
+                append(block);
+                _line += ": ";
+                append(matrix);
+                appendComment(comment);
+                flush();
+            }
+
+            /**
+             * Writes the end of the file marker.
+             */
+            void end() {
+                _line += "end";
+                flush();
+            }
+
+            /**
+             * Writes a whole level, grouping consecutive blocks of the same type onto one line.
+             * @param level The level to write.
+             */
+            void write(const Level& level) {
+                std::vector<std::string> keys;
+                for (auto const& [k, v] : level.headers()) keys.push_back(k);
+                std::sort(keys.begin(), keys.end());
+
+                for (const std::string& k : keys)
+                    header(k, level.headers().at(k));
+
+                endHeaders();
+
+                const BlockList& blocks = level.blocks();
+                for (size_t i = 0; i < blocks.size();) {
+                    append(blocks[i].block());
+                    _line += ": ";
+
+                    size_t j = i;
+                    for (; j < blocks.size() && blocks[j].block() == blocks[i].block(); j++) {
+                        if (j > i) _line += '*';
+                        if (blocks[j].is2D())
+                            append(blocks[j].coordinate2D());
+                        else
+                            append(blocks[j].coordinate3D());
+                    }
+
+                    flush();
+                    i = j;
+                }
+
+                end();
+            }
+
+        private:
+            /**
+             * Appends a number, without a fractional part if it is integral.
+             * @param value The number to append.
+             */
+            void append(double value) {
+                if (std::floor(value) == value && std::abs(value) < 1e15)
+                    _line += std::to_string(static_cast<long long>(value));
+                else
+                    _line += std::to_string(value);
+            }
+
+            /**
+             * Appends a block, with its properties sorted by key.
+             * @param block The block to append.
+             */
+            void append(const Block& block) {
+                _line += block.name;
+                if (block.properties.empty()) return;
+
+                std::vector<const std::pair<const std::string, std::string>*> properties;
+                for (auto const& p : block.properties) properties.push_back(&p);
+                std::sort(properties.begin(), properties.end(), [](auto a, auto b) { return a->first < b->first; });
+
+                _line += '<';
+                for (size_t i = 0; i < properties.size(); i++) {
+                    if (i > 0) _line += ", ";
+                    _line += properties[i]->first;
+                    _line += '=';
+                    _line += properties[i]->second;
+                }
+                _line += '>';
+            }
+
+            /**
+             * Appends a 2D coordinate.
+             * @param c The coordinate to append.
+             */
+            void append(const Coordinate2D& c) {
+                _line += '[';
+                append(c.x);
+                _line += ", ";
+                append(c.y);
+                _line += ']';
+            }
+
+            /**
+             * Appends a 3D coordinate.
+             * @param c The coordinate to append.
+             */
+            void append(const Coordinate3D& c) {
+                _line += '[';
+                append(c.x);
+                _line += ", ";
+                append(c.y);
+                _line += ", ";
+                append(c.z);
+                _line += ']';
+            }
+
+            /**
+             * Appends a 2D coordinate matrix.
+             * @param m The matrix to append.
+             */
+            void append(const CoordinateMatrix2D& m) {
+                _line += '(' + std::to_string(m.minX) + ", " + std::to_string(m.maxX) + ", " + std::to_string(m.minY) + ", " + std::to_string(m.maxY) + ")^";
+                append(m.start);
+            }
+
+            /**
+             * Appends a 3D coordinate matrix.
+             * @param m The matrix to append.
+             */
+            void append(const CoordinateMatrix3D& m) {
+                _line += '(' + std::to_string(m.minX) + ", " + std::to_string(m.maxX) + ", " + std::to_string(m.minY) + ", " + std::to_string(m.maxY) + ", " + std::to_string(m.minZ) + ", " + std::to_string(m.maxZ) + ")^";
+                append(m.start);
+            }
+
+            void appendComment(const std::string& comment) {
+                if (comment.empty()) return;
+
+                _line += " # ";
+                _line += comment;
+            }
+    };
+
+}
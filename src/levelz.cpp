@@ -0,0 +1,3 @@
+// Compiles the parser once for the levelz-cpp-static and levelz-cpp-shared libraries
+#define LEVELZ_IMPLEMENTATION
+#include "levelz.hpp"
@@ -0,0 +1,103 @@
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    LevelZ::GeneratorOptions generator;
+    generator.lines = 500;
+    generator.seed = 35;
+    generator.trailingLines = 3;
+    const std::string contents = LevelZ::generateContents(generator);
+    const Level expected = LevelZ::parseContents(contents);
+
+    // Streaming Parser
+    LevelZ::LevelParser p1;
+    for (char c : contents)
+        p1.feed(std::string_view(&c, 1));
+
+    r |= assert(p1.ended());
+    r |= assert(p1.bytes() == contents.size());
+    r |= assert(p1.finish() == expected);
+
+    LevelZ::LevelParser p2;
+    p2.feed("@type 3\r\n---\r\nstone: [0, 0, 0]*[1, ");
+    r |= assert(p2.blocks() == 0);
+    p2.feed("1, 1]\r\ngrass: (0, 1, 0, 0, 0, 0)^[0, 0, 5]");
+    r |= assert(p2.blocks() == 2);
+
+    Level3D l1 = Level3D(p2.finish());
+    r |= assert(l1.blocks().size() == 4);
+    r |= assert(l1.blocks()[3].coordinate3D() == Coordinate3D(1, 0, 5));
+
+    LevelZ::LevelParser p3;
+    p3.feed("@type 2\ngrass: [0, 0]\n");
+    try {
+        p3.finish();
+        r |= 1;
+    } catch (const std::out_of_range&) {}
+
+    // Loading
+    const std::string file = (std::filesystem::temp_directory_path() / "levelz-test-async.lvlz").string();
+    std::ofstream(file) << contents;
+
+    LevelZ::LoadOptions options;
+    options.chunkSize = 97;
+
+    size_t reports = 0;
+    LevelZ::LoadProgress last;
+    options.progress = [&](const LevelZ::LoadProgress& progress) {
+        reports++;
+        last = progress;
+    };
+
+    r |= assert(LevelZ::loadFile(file, options) == expected);
+    r |= assert(reports > 1);
+    r |= assert(last.blocks == expected.blocks().size());
+    r |= assert(last.total == contents.size());
+    r |= assert(last.fraction() > 0.5 && last.fraction() <= 1.0);
+
+    std::future<Level> f1 = LevelZ::loadFileAsync(file, options);
+    r |= assert(f1.get() == expected);
+
+    std::future<Level> f2 = LevelZ::parseContentsAsync(contents);
+    r |= assert(f2.get() == expected);
+
+    // Cancellation
+    LevelZ::LoadOptions cancelled;
+    cancelled.chunkSize = 64;
+    cancelled.progress = [&cancelled](const LevelZ::LoadProgress& progress) {
+        if (progress.bytes >= 128) cancelled.token.cancel();
+    };
+
+    std::future<Level> f3 = LevelZ::loadFileAsync(file, cancelled);
+    try {
+        f3.get();
+        r |= 1;
+    } catch (const LevelZ::LoadCancelled&) {}
+
+    try {
+        LevelZ::loadFile(file + ".missing");
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+#ifdef LEVELZ_COROUTINES
+    // Coroutines
+    Level l2 = LevelZ::loadFileTask(file, options).get();
+    r |= assert(l2 == expected);
+
+    auto chained = [](std::string file) -> LevelZ::Task<size_t> {
+        Level level = co_await LevelZ::loadFileTask(file);
+        co_return level.blocks().size();
+    };
+    r |= assert(chained(file).get() == expected.blocks().size());
+#endif
+
+    std::filesystem::remove(file);
+
+    return r;
+}
@@ -0,0 +1,63 @@
+#include <iostream>
+#include <sstream>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    // XXH64 reference values
+    r |= assert(LevelZ::xxhash64("", 0) == 0xEF46DB3751D8E999ULL);
+    r |= assert(LevelZ::xxhash64("abc", 3) == 0x44BC2CF5AD770999ULL);
+
+    const std::string text = "The quick brown fox jumps over the lazy dog, again and again.";
+    r |= assert(LevelZ::xxhash64(text.data(), text.size()) == LevelZ::xxhash64(text.data(), text.size()));
+    r |= assert(LevelZ::xxhash64(text.data(), text.size()) != LevelZ::xxhash64(text.data(), text.size(), 1));
+    r |= assert(LevelZ::xxhash64(text.data(), text.size()) != LevelZ::xxhash64(text.data(), text.size() - 1));
+
+    // Round Trips
+    Level l1 = LevelZ::parseLines({
+        "@type 2",
+        "@spawn [1, 2]",
+        "---",
+        "grass<type=1, wet=true>: [0, 0]*[0.5, -1.25]",
+        "stone: (0, 2, 0, 1)^[4, 4]",
+        "grass<type=1, wet=true>: [9, 9]"
+    });
+
+    std::string binary = LevelZ::serializeLevel(l1);
+    r |= assert(binary.compare(0, 4, "LVZB") == 0);
+
+    Level l2 = LevelZ::deserializeLevel(binary);
+    r |= assert(l2 == l1);
+    r |= assert(l2.headers().at("spawn") == "[1, 2]");
+    r |= assert(l2.blocks()[1].coordinate2D() == Coordinate2D(0.5, -1.25));
+    r |= assert(l2.blocks()[8].block().getBool("wet"));
+    r |= assert(static_cast<Level2D>(l2).spawn == Coordinate2D(1, 2));
+
+    Level3D l3 = Level3D(LevelZ::parseLines({"@type 3", "---", "stone: [0, 0, 0]*[1, 2, 3]"}));
+    std::ostringstream out;
+    LevelZ::serializeLevel(l3, out);
+    Level3D l4 = Level3D(LevelZ::deserializeLevel(out.str()));
+    r |= assert(l4 == l3);
+    r |= assert(l4.blocks()[1].coordinate3D() == Coordinate3D(1, 2, 3));
+    r |= assert(!l4.blocks()[1].is2D());
+
+    // Malformed Data
+    for (size_t i = 0; i < binary.size(); i++) {
+        try {
+            LevelZ::deserializeLevel(std::string_view(binary.data(), i));
+            r |= 1;
+        } catch (const std::invalid_argument&) {}
+    }
+
+    std::string corrupt = binary;
+    corrupt[0] = 'X';
+    try {
+        LevelZ::deserializeLevel(corrupt);
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    return r;
+}
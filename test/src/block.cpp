@@ -14,5 +14,43 @@ int main() {
     LevelZ::Block block("test", {{"key", "value"}});
     r |= assert(block.getProperty("key") == "value");
 
+    // #getInt, #getBool, #getDouble
+    LevelZ::Block typed("test", {{"count", "3"}, {"cracked", "false"}, {"speed", "1.5"}});
+    r |= assert(typed.getInt("count") == 3);
+    r |= assert(typed.getBool("cracked") == false);
+    r |= assert(typed.getDouble("speed") == 1.5);
+    r |= assert(typed.getDouble("count") == 3);
+    r |= assert(typed.getInt("speed", -1) == -1);
+    r |= assert(typed.getInt("missing", 7) == 7);
+
+    typed.setProperty("count", "4");
+    r |= assert(typed.getInt("count") == 4);
+
+    // #getEnum
+    LevelZ::BlockSchema::registerSchema("ore", LevelZ::BlockSchema().property("amount", LevelZ::PropertyType::INT).enumeration("kind", {"iron", "gold"}));
+    LevelZ::Block ore("ore", {{"amount", "2"}, {"kind", "gold"}});
+    r |= assert(ore.getEnum("kind") == 1);
+    r |= assert(ore.getValue("amount").type == LevelZ::PropertyType::INT);
+
+    bool thrown = false;
+    try {
+        LevelZ::Block("ore", {{"amount", "many"}});
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    r |= assert(thrown);
+    LevelZ::BlockSchema::unregisterSchema("ore");
+
+    // std::hash
+    std::hash<LevelZ::Block> hb;
+    r |= assert(hb(LevelZ::Block("test", {{"a", "1"}, {"b", "2"}})) == hb(LevelZ::Block("test", {{"b", "2"}, {"a", "1"}})));
+
+    // LevelObject equality
+    LevelZ::LevelObject o1(LevelZ::Block("test"), LevelZ::Coordinate2D(3, 4));
+    LevelZ::LevelObject o2(LevelZ::Block("test"), LevelZ::Coordinate2D(4, 3));
+    r |= assert(o1 != o2);
+    r |= assert(o1 == LevelZ::LevelObject(LevelZ::Block("test"), LevelZ::Coordinate2D(3, 4)));
+    r |= assert(std::hash<LevelZ::LevelObject>()(o1) == std::hash<LevelZ::LevelObject>()(LevelZ::LevelObject(LevelZ::Block("test"), LevelZ::Coordinate2D(3, 4))));
+
     return r;
 }
\ No newline at end of file
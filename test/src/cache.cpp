@@ -0,0 +1,68 @@
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    const std::filesystem::path root = std::filesystem::temp_directory_path() / "levelz-test-cache";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+
+    const std::string file = (root / "level.lvlz").string();
+    std::ofstream(file) << "@type 2\n---\ngrass: [0, 0]*(0, 1, 0, 1)^[2, 2]\nstone: [0, 0]\nend\n";
+    const Level expected = LevelZ::parseFile(file);
+
+    LevelZ::LevelCache cache(root / "cache");
+    r |= assert(std::filesystem::is_directory(cache.directory()));
+
+    // Miss, then Hit
+    r |= assert(cache.load(file) == expected);
+    r |= assert(cache.misses() == 1 && cache.hits() == 0);
+
+    r |= assert(cache.load(file) == expected);
+    r |= assert(cache.misses() == 1 && cache.hits() == 1);
+
+    LevelZ::MappedFile source(file);
+    r |= assert(source.size() == std::filesystem::file_size(file));
+    const uint64_t hash = LevelZ::xxhash64(source.data(), source.size());
+    r |= assert(std::filesystem::exists(cache.path(hash)));
+
+    // Options are cached separately
+    LevelZ::ParseOptions options;
+    options.deduplicate = true;
+    r |= assert(cache.load(file, options).blocks().size() == 5);
+    r |= assert(cache.load(file, options).blocks().size() == 5);
+    r |= assert(cache.misses() == 2 && cache.hits() == 2);
+
+    // Changed Source
+    std::ofstream(file) << "@type 2\n---\nwater: [5, 5]\n";
+    Level changed = cache.load(file);
+    r |= assert(changed.blocks().size() == 1);
+    r |= assert(changed.blocks()[0].block().name == "water");
+    r |= assert(cache.misses() == 3);
+
+    // Corrupt Entry
+    LevelZ::MappedFile updated(file);
+    const std::filesystem::path entry = cache.path(LevelZ::xxhash64(updated.data(), updated.size()));
+    std::ofstream(entry, std::ios::binary | std::ios::trunc) << "garbage";
+    r |= assert(cache.load(file).blocks().size() == 1);
+    r |= assert(cache.misses() == 4);
+    r |= assert(cache.load(file).blocks().size() == 1);
+    r |= assert(cache.hits() == 3);
+
+    cache.clear();
+    r |= assert(!std::filesystem::exists(entry));
+
+    try {
+        cache.load((root / "missing.lvlz").string());
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    std::filesystem::remove_all(root);
+
+    return r;
+}
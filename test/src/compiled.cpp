@@ -0,0 +1,26 @@
+#include <iostream>
+
+#include "test.h"
+#include "levelz.hpp"
+
+LevelZ::Level parseUnit(const std::string& contents);
+
+int main() {
+    int r = 0;
+
+    const std::string contents = "@type 2\n@spawn [1, 1]\n---\ngrass: [0, 0]*[1, 0]";
+
+    // Both translation units share the compiled parser
+    Level a = parseContents(contents);
+    Level b = parseUnit(contents);
+    r |= assert(a.blocks().size() == 2);
+    r |= assert(a.headers() == b.headers());
+    r |= assert(a.blocks().size() == b.blocks().size());
+    for (size_t i = 0; i < a.blocks().size(); i++)
+        r |= assert(a.blocks()[i] == b.blocks()[i]);
+
+    Level c = parseLines({"@type 3", "---", "stone: [0, 0, 0]"});
+    r |= assert(c.blocks().size() == 1);
+
+    return r;
+}
@@ -0,0 +1,6 @@
+#define LEVELZ_NO_USING_NAMESPACE
+#include "levelz.hpp"
+
+LevelZ::Level parseUnit(const std::string& contents) {
+    return LevelZ::parseContents(contents);
+}
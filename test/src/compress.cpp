@@ -0,0 +1,97 @@
+#include <iostream>
+#include <sstream>
+#include <filesystem>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    LevelZ::GeneratorOptions generator;
+    generator.lines = 2000;
+    generator.seed = 41;
+    const std::string contents = LevelZ::generateContents(generator);
+    const Level expected = LevelZ::parseContents(contents);
+
+    // Round Trip
+    std::stringstream gzip;
+    LevelZ::writeCompressed(expected, gzip);
+    const std::string compressed = gzip.str();
+    r |= assert(compressed.size() > 2);
+    r |= assert(static_cast<unsigned char>(compressed[0]) == 0x1f && static_cast<unsigned char>(compressed[1]) == 0x8b);
+    r |= assert(compressed.size() < contents.size());
+    r |= assert(LevelZ::parseCompressed(gzip) == expected);
+
+    std::stringstream zlib;
+    LevelZ::writeCompressed(expected, zlib, 9, LevelZ::CompressionFormat::ZLIB);
+    r |= assert(LevelZ::parseCompressed(zlib) == expected);
+
+    // Small Chunks
+    std::stringstream raw;
+    {
+        LevelZ::CompressedOutput out(raw, 1);
+        out << contents;
+    }
+
+    LevelZ::CompressedInput input(raw, 7);
+    LevelZ::LevelParser parser;
+    size_t chunks = 0;
+    for (std::string_view chunk = input.next(); !chunk.empty(); chunk = input.next()) {
+        r |= assert(chunk.size() <= 7);
+        parser.feed(chunk);
+        chunks++;
+    }
+
+    r |= assert(chunks > 1);
+    r |= assert(input.bytes() == contents.size());
+    r |= assert(input.compressedBytes() == raw.str().size());
+    r |= assert(parser.finish() == expected);
+
+    // Concatenated Members
+    std::stringstream members;
+    {
+        LevelZ::CompressedOutput first(members);
+        first << "@type 2\n---\ngrass: [0, 0]\n";
+    }
+    {
+        LevelZ::CompressedOutput second(members);
+        second << "stone: [1, 1]";
+    }
+
+    Level concatenated = LevelZ::parseCompressed(members);
+    r |= assert(concatenated.blocks().size() == 2);
+    r |= assert(concatenated.blocks()[1].block().name == "stone");
+
+    // Files
+    std::filesystem::path file = std::filesystem::temp_directory_path() / "levelz-test-compress.lvlz.gz";
+    LevelZ::writeCompressedFile(expected, file.string());
+    r |= assert(LevelZ::parseCompressedFile(file.string()) == expected);
+    std::filesystem::remove(file);
+
+    // Errors
+    std::stringstream truncated(compressed.substr(0, compressed.size() / 2));
+    try {
+        LevelZ::parseCompressed(truncated);
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    std::stringstream corrupt("not compressed at all");
+    try {
+        LevelZ::parseCompressed(corrupt);
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    try {
+        LevelZ::parseCompressedFile("missing.lvlz.gz");
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    try {
+        std::stringstream out;
+        LevelZ::CompressedOutput invalid(out, 42);
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    return r;
+}
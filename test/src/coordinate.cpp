@@ -24,6 +24,17 @@ int main() {
     r |= assert(LevelZ::Coordinate2D(3, 4).getMagnitude() == 25);
     r |= assert(LevelZ::Coordinate3D(3, 4, 5).getMagnitude() == 50);
 
+    // scalars
+    r |= assert(LevelZ::Coordinate2D(1, 2) * 1.5 == LevelZ::Coordinate2D(1.5, 3.0));
+    r |= assert(LevelZ::Coordinate3D(2, 4, 6) / 2 == LevelZ::Coordinate3D(1, 2, 3));
+
+    // std::hash
+    std::hash<LevelZ::Coordinate2D> h2;
+    std::hash<LevelZ::Coordinate3D> h3;
+    r |= assert(h2(LevelZ::Coordinate2D(1, 2)) == h2(LevelZ::Coordinate2D(1, 2)));
+    r |= assert(h2(LevelZ::Coordinate2D(0.0, 1.0)) == h2(LevelZ::Coordinate2D(-0.0, 1.0)));
+    r |= assert(h3(LevelZ::Coordinate3D(1, 2, 3)) != h3(LevelZ::Coordinate3D(3, 2, 1)));
+
     // #from_string
     r |= assert(LevelZ::Coordinate2D::from_string("[1, 2]") == LevelZ::Coordinate2D(1, 2));
     r |= assert(LevelZ::Coordinate2D::from_string("[-2,4]") == LevelZ::Coordinate2D(-2,4));
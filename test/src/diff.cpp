@@ -0,0 +1,46 @@
+#include <iostream>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    Level2D l1 = Level2D({{"scroll", "none"}}, {
+        LevelObject(Block("grass"), Coordinate2D(0, 0)),
+        LevelObject(Block("stone"), Coordinate2D(1, 0)),
+        LevelObject(Block("dirt"), Coordinate2D(2, 0))
+    });
+
+    // order-insensitive equality
+    Level2D l2 = Level2D({{"scroll", "none"}}, {
+        LevelObject(Block("dirt"), Coordinate2D(2, 0)),
+        LevelObject(Block("grass"), Coordinate2D(0, 0)),
+        LevelObject(Block("stone"), Coordinate2D(1, 0))
+    });
+    r |= assert(l1 == l2);
+    r |= assert(l1.fingerprint() == l2.fingerprint());
+    r |= assert(LevelZ::diff(l1, l2).empty());
+
+    // #diff
+    Level2D l3 = Level2D({{"scroll", "vertical-up"}, {"author", "me"}}, {
+        LevelObject(Block("grass"), Coordinate2D(0, 0)),
+        LevelObject(Block("stone", {{"cracked", "true"}}), Coordinate2D(1, 0)),
+        LevelObject(Block("water"), Coordinate2D(3, 0))
+    });
+    r |= assert(l1 != l3);
+    r |= assert(l1.fingerprint() != l3.fingerprint());
+
+    LevelZ::LevelDiff d = LevelZ::diff(l1, l3);
+    r |= assert(d.added.size() == 1 && d.added[0].block().name == "water");
+    r |= assert(d.removed.size() == 1 && d.removed[0].block().name == "dirt");
+    r |= assert(d.changed.size() == 1 && d.changed[0].after.block().getBool("cracked"));
+    r |= assert(d.headersSet.size() == 2 && d.headersSet.at("scroll") == "vertical-up");
+    r |= assert(d.headersRemoved.empty());
+
+    // #patch
+    r |= assert(LevelZ::patch(l1, d) == l3);
+    r |= assert(LevelZ::patch(l3, LevelZ::diff(l3, l1)) == l1);
+
+    return r;
+}
@@ -0,0 +1,50 @@
+#include <iostream>
+#include <sstream>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    LevelZ::GeneratorOptions options;
+    options.lines = 200;
+    options.seed = 42;
+    options.matrixRatio = 0.25;
+    options.commentDensity = 0.2;
+    options.trailingLines = 3;
+
+    // determinism
+    std::string a = LevelZ::generateContents(options);
+    r |= assert(a == LevelZ::generateContents(options));
+
+    options.seed = 43;
+    r |= assert(a != LevelZ::generateContents(options));
+
+    // 2D
+    std::ostringstream out;
+    LevelZ::GeneratorResult result = LevelZ::generate(out, options);
+    r |= assert(result.bytes == out.str().size());
+
+    Level2D l2 = static_cast<Level2D>(LevelZ::parseContents(out.str()));
+    r |= assert(l2.blocks().size() == result.blocks);
+    r |= assert(l2.blocks()[0].block().getInt("p0") < 4);
+
+    // 3D
+    options.is2D = false;
+    options.properties = 0;
+    options.endMarker = false;
+    std::ostringstream out3;
+    result = LevelZ::generate(out3, options);
+
+    Level3D l3 = static_cast<Level3D>(LevelZ::parseContents(out3.str()));
+    r |= assert(l3.blocks().size() == result.blocks);
+    r |= assert(!l3.blocks()[0].is2D());
+
+    // LevelWriter round trip
+    std::ostringstream written;
+    LevelZ::LevelWriter(written).write(l2);
+    r |= assert(LevelZ::parseContents(written.str()) == LevelZ::Level(l2));
+
+    return r;
+}
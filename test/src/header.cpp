@@ -0,0 +1,63 @@
+#include <iostream>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    // Parse 2D
+    LevelZ::LevelHeader h1 = LevelZ::LevelHeader::parse({{"type", "2"}, {"spawn", "[-2, 4]"}, {"scroll", "vertical-down"}, {"author", "me"}});
+    r |= assert(h1.is2D());
+    r |= assert(h1.type == 2);
+    r |= assert(h1.spawn == Coordinate3D(-2.0, 4.0, 0.0));
+    r |= assert(h1.spawn2D() == Coordinate2D(-2.0, 4.0));
+    r |= assert(h1.scroll == Scroll::VERTICAL_DOWN);
+    r |= assert(h1.extra.size() == 1 && h1.extra.at("author") == "me");
+
+    // Parse 3D
+    LevelZ::LevelHeader h2 = LevelZ::LevelHeader::parse({{"type", "3"}, {"spawn", "[1, 2, 3]"}, {"scroll", "horizontal-left"}});
+    r |= assert(!h2.is2D());
+    r |= assert(h2.spawn == Coordinate3D(1.0, 2.0, 3.0));
+    r |= assert(h2.scroll == Scroll::NONE);
+    r |= assert(h2.extra.empty());
+
+    // Defaults
+    LevelZ::LevelHeader h3 = LevelZ::LevelHeader::parse({});
+    r |= assert(h3.is2D());
+    r |= assert(h3.spawn == Coordinate3D(0.0, 0.0, 0.0));
+    r |= assert(h3.scroll == Scroll::NONE);
+    r |= assert(LevelZ::LevelHeader::parseScroll("sideways") == Scroll::NONE);
+    r |= assert(LevelZ::LevelHeader::parseScroll("horizontal-right") == Scroll::HORIZONTAL_RIGHT);
+
+    // Levels
+    Level2D l1 = Level2D({{"scroll", "horizontal-left"}, {"spawn", "[3, 5]"}}, {});
+    r |= assert(l1.header().type == 2);
+    r |= assert(l1.headers().at("type") == "2");
+    r |= assert(l1.header().scroll == Scroll::HORIZONTAL_LEFT);
+    r |= assert(l1.spawn == Coordinate2D(3.0, 5.0));
+
+    Level3D l2 = Level3D({{"spawn", "[1, 2, 3]"}}, {});
+    r |= assert(l2.header().type == 3);
+    r |= assert(l2.spawn == Coordinate3D(1.0, 2.0, 3.0));
+
+    Level l3 = LevelZ::parseLines({
+        "@type 3",
+        "@spawn [4, 5, 6]",
+        "@name test",
+        "---",
+        "grass: [0, 0, 0]"
+    });
+    r |= assert(l3.header().type == 3);
+    r |= assert(l3.header().spawn == Coordinate3D(4.0, 5.0, 6.0));
+    r |= assert(l3.header().extra.at("name") == "test");
+    r |= assert(static_cast<Level3D>(l3).spawn == Coordinate3D(4.0, 5.0, 6.0));
+
+    // Errors
+    try {
+        LevelZ::LevelHeader::parse({{"type", "3"}, {"spawn", "nowhere"}});
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    return r;
+}
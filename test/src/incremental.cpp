@@ -0,0 +1,53 @@
+#include <iostream>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    std::vector<std::string> lines = {
+            "@type 2",
+            "@spawn [0, 0]",
+            "---",
+            "grass: [0, 0]*[1, 0]",
+            "# Comment",
+            "stone: [0, 1]",
+            "dirt: [0, 2]*[1, 2]*[2, 2]",
+            "end",
+            "Trailing notes"
+    };
+
+    LevelZ::IncrementalLevel level(lines);
+    r |= assert(level.level().blocks().size() == 6);
+    r |= assert(level.blockRange(5) == std::make_pair<size_t, size_t>(2, 1));
+    r |= assert(level.blockRange(6) == std::make_pair<size_t, size_t>(3, 3));
+
+    // single line
+    r |= assert(level.setLine(5, "stone: [0, 1]*[1, 1]"));
+    r |= assert(level.level().blocks().size() == 7);
+    r |= assert(level.level().blocks()[3] == LevelObject(Block("stone"), Coordinate2D(1, 1)));
+    r |= assert(level.blockRange(6) == std::make_pair<size_t, size_t>(4, 3));
+
+    // insertion and removal
+    r |= assert(level.edit(3, 2, {"water: [5, 5]"}));
+    r |= assert(level.level().blocks().size() == 6);
+    r |= assert(level.level().blocks()[0].block().name == "water");
+
+    // after the end marker
+    r |= assert(level.setLine(7, "Other notes"));
+    r |= assert(level.level().blocks().size() == 6);
+
+    // matches a full parse
+    r |= assert(level.level() == LevelZ::parseLines(level.lines()));
+
+    // header and end marker edits re-parse the level
+    r |= assert(!level.setLine(1, "@spawn [1, 1]"));
+    r |= assert(static_cast<Level2D>(level.level()).spawn == Coordinate2D(1, 1));
+
+    r |= assert(!level.edit(6, 2, {}));
+    r |= assert(level.level().blocks().size() == 6);
+    r |= assert(level.level() == LevelZ::parseLines(level.lines()));
+
+    return r;
+}
@@ -0,0 +1,61 @@
+#include <iostream>
+
+#include "test.h"
+#include "levelz.hpp"
+
+struct CountingObserver : LevelZ::ParseObserver {
+    int stages = 0;
+    int completed = 0;
+    size_t count = 0;
+
+    void onStage(LevelZ::ParseStage stage, std::chrono::nanoseconds duration) override {
+        stages++;
+    }
+
+    void onComplete(const LevelZ::ParseStats& stats) override {
+        completed++;
+    }
+
+    size_t allocations() override {
+        return count += 5;
+    }
+};
+
+int main() {
+    int r = 0;
+
+    std::string contents = "@type 2\n---\ngrass: [0, 0]*(0, 1, 0, 1)^[4, 4]\nstone: [0, 0]\nend\n";
+
+    LevelZ::ParseStats stats;
+    CountingObserver observer;
+
+    LevelZ::ParseOptions options;
+    options.stats = &stats;
+    options.observer = &observer;
+    options.deduplicate = true;
+
+    Level2D level = static_cast<Level2D>(LevelZ::parseContents(contents, options));
+    r |= assert(level.blocks().size() == 5);
+
+    r |= assert(stats.bytes == contents.size());
+    r |= assert(stats.lines == 6);
+    r |= assert(stats.objects == 5);
+    r |= assert(stats.peakBlocks == 6);
+    r |= assert(stats.matrixCoordinates == 4);
+    r |= assert(stats.allocations == 5);
+    r |= assert(stats.total() >= stats.matrices);
+
+    r |= assert(observer.stages == 6);
+    r |= assert(observer.completed == 1);
+
+    // parseLines reports every stage except reading
+    LevelZ::ParseStats lineStats;
+    LevelZ::ParseOptions lineOptions;
+    lineOptions.stats = &lineStats;
+    LevelZ::parseLines({"@type 3", "---", "stone: [0, 0, 0]*[1, 1, 1]"}, lineOptions);
+    r |= assert(lineStats.objects == 2);
+    r |= assert(lineStats.read.count() == 0);
+    r |= assert(lineStats.lines == 3);
+
+    return r;
+}
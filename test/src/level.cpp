@@ -45,6 +45,24 @@ int main() {
     r |= assert(l5.scroll() == Scroll::NONE);
     r |= assert(l5.spawn == Coordinate2D(-10, 4));
     r |= assert(l5.blocks().size() == 4);
+    r |= assert(l5.blocks()[0].block().getInt("type") == 1);
+    r |= assert(l5.blocks()[2].block().getBool("cracked") == false);
+
+    // Deduplication
+    std::vector<std::string> l6v = {
+            "@type 2",
+            "---",
+            "grass: [0, 0]*[1, 0]",
+            "stone: [1, 0]*[2, 0]"
+    };
+    r |= assert(LevelZ::parseLines(l6v).blocks().size() == 4);
+
+    LevelZ::ParseOptions dedup;
+    dedup.deduplicate = true;
+    Level2D l6 = static_cast<Level2D>(LevelZ::parseLines(l6v, dedup));
+    r |= assert(l6.blocks().size() == 3);
+    r |= assert(l6.blocks()[0].block().name == "grass");
+    r |= assert(l6.blocks()[1] == LevelObject(Block("stone"), Coordinate2D(1, 0)));
 
     return r;
 }
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include <iostream>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    Level3D level = Level3D(LevelZ::parseLines({
+        "@type 3",
+        "---",
+        "stone: (0, 63, 0, 3, 0, 63)^[0, 0, 0]",
+        "grass: (0, 63, 4, 4, 0, 63)^[0, 0, 0]",
+        "gold: [-100, 200, -5]"
+    }));
+
+    LevelZ::LevelPyramid pyramid(level, 8, 2);
+    r |= assert(pyramid.levels() == 8);
+    r |= assert(pyramid.cells(0) == 64 * 64 * 5 + 1);
+
+    // Counts
+    r |= assert(pyramid.count(0, 0, 0, 0) == 1);
+    r |= assert(pyramid.count(1, 0, 0, 0) == 8);
+    r |= assert(pyramid.count(2, 0, 1, 0) == 16);
+    r |= assert(pyramid.count(6, 0, 0, 0) == 64 * 64 * 5);
+    r |= assert(pyramid.count(8, 0, 0, 0) == 64 * 64 * 5);
+    r |= assert(pyramid.count(3, -13, 25, -1) == 1);
+    r |= assert(pyramid.count(8, -1, 0, -1) == 1);
+    r |= assert(pyramid.cells(8) == 2);
+    r |= assert(pyramid.cells(4) == 16 + 1);
+
+    // Dominant Blocks
+    r |= assert(pyramid.dominant(0, 0, 4, 0)->name == "grass");
+    r |= assert(pyramid.dominant(2, 0, 1, 0)->name == "grass");
+    r |= assert(pyramid.dominant(3, 0, 0, 0)->name == "stone");
+    r |= assert(pyramid.dominant(7, -1, 1, -1)->name == "gold");
+    r |= assert(pyramid.dominant(5, 5, 5, 5) == nullptr);
+
+    // Coarse Queries
+    r |= assert(pyramid.empty(6, 0, 1, 0));
+    r |= assert(!pyramid.empty(6, 0, 0, 0));
+    r |= assert(pyramid.empty(CoordinateMatrix3D(0, 63, 5, 68, 0, 63, Coordinate3D(0.0, 0.0, 0.0))));
+    r |= assert(!pyramid.empty(CoordinateMatrix3D(0, 63, 4, 68, 0, 63, Coordinate3D(0.0, 0.0, 0.0))));
+    r |= assert(!pyramid.empty(CoordinateMatrix3D(63, 63, 4, 4, 63, 63, Coordinate3D(0.0, 0.0, 0.0))));
+    r |= assert(pyramid.empty(CoordinateMatrix3D(64, 1000, 0, 1000, 0, 1000, Coordinate3D(0.0, 0.0, 0.0))));
+    r |= assert(!pyramid.empty(CoordinateMatrix3D(-101, -99, 199, 201, -6, -4, Coordinate3D(0.0, 0.0, 0.0))));
+
+    // Incremental Updates
+    pyramid.set(1, 4, 1, Block("stone"));
+    r |= assert(pyramid.count(1, 0, 2, 0) == 4);
+    r |= assert(pyramid.dominant(1, 0, 2, 0)->name == "grass");
+    pyramid.set(0, 4, 0, Block("stone"));
+    pyramid.set(0, 4, 1, Block("stone"));
+    pyramid.set(1, 4, 0, Block("stone"));
+    r |= assert(pyramid.dominant(1, 0, 2, 0)->name == "stone");
+
+    r |= assert(pyramid.erase(-100, 200, -5));
+    r |= assert(!pyramid.erase(-100, 200, -5));
+    r |= assert(pyramid.cells(8) == 1);
+    r |= assert(pyramid.empty(CoordinateMatrix3D(-101, -99, 199, 201, -6, -4, Coordinate3D(0.0, 0.0, 0.0))));
+
+    pyramid.set(500, 0, 0, Block("gold"));
+    r |= assert(pyramid.count(8, 1, 0, 0) == 1);
+    r |= assert(!pyramid.empty(CoordinateMatrix3D(64, 1000, 0, 1000, 0, 1000, Coordinate3D(0.0, 0.0, 0.0))));
+
+    // Parallel Builds
+    LevelZ::LevelPyramid single(level, 4, 1);
+    LevelZ::LevelPyramid parallel(level, 4, 4);
+    for (int k = 1; k <= 4; k++)
+        r |= assert(single.cells(k) == parallel.cells(k));
+
+    // 2D Levels
+    LevelZ::LevelPyramid flat(Level2D(LevelZ::parseLines({
+        "@type 2",
+        "---",
+        "grass: (0, 9, 0, 0, 0, 0)^[0, 0]"
+    })), 4);
+    r |= assert(flat.count(4, 0, 0, 0) == 10);
+    r |= assert(flat.empty(1, 0, 0, 1));
+
+    // Errors
+    try {
+        pyramid.count(9, 0, 0, 0);
+        r |= 1;
+    } catch (const std::out_of_range&) {}
+
+    try {
+        LevelZ::LevelPyramid invalid(level, 0);
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    return r;
+}
@@ -16,6 +16,16 @@ int main() {
     r |= assert(matrix3d.getCoordinates().size() == 27);
     r |= assert(matrix3d.start == LevelZ::Coordinate3D());
 
+    // start offset
+    LevelZ::CoordinateMatrix2D offset2d = LevelZ::CoordinateMatrix2D(0, 1, 0, 1, LevelZ::Coordinate2D(5, 5));
+    r |= assert(offset2d.size() == 4);
+    r |= assert(*offset2d.begin() == LevelZ::Coordinate2D(5, 5));
+    r |= assert(offset2d.getCoordinates().back() == LevelZ::Coordinate2D(6, 6));
+
+    size_t count = 0;
+    for (const LevelZ::Coordinate3D& c : matrix3d) count++;
+    r |= assert(count == matrix3d.size());
+
     // #from_string
     r |= assert(LevelZ::CoordinateMatrix2D::from_string("(0, 3, 0, 3)^[-1, 2]") == LevelZ::CoordinateMatrix2D(0, 3, 0, 3, LevelZ::Coordinate2D(-1, 2)));
     r |= assert(LevelZ::CoordinateMatrix3D::from_string("(0, 3, 0, 3, 0, 3)^[-1, 2, 3]") == LevelZ::CoordinateMatrix3D(0, 3, 0, 3, 0, 3, LevelZ::Coordinate3D(-1, 2, 3)));
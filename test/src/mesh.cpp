@@ -0,0 +1,97 @@
+#include <iostream>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    // Single Cube
+    LevelZ::GreedyMesher m1(Level3D({{"type", "3"}}, {
+        LevelObject(Block("stone"), Coordinate3D(0.0, 0.0, 0.0))
+    }));
+    r |= assert(m1.dirty() == 1);
+    r |= assert(m1.update() == 1);
+    r |= assert(m1.dirty() == 0);
+    r |= assert(m1.quads() == 6);
+
+    for (const LevelZ::MeshQuad& quad : *m1.chunk(0, 0, 0)) {
+        r |= assert(quad.width == 1 && quad.height == 1 && quad.material == 0);
+
+        std::array<Coordinate3D, 4> c = quad.corners();
+        Coordinate3D e1 = c[1] - c[0], e2 = c[2] - c[0];
+        Coordinate3D cross = Coordinate3D(e1.y * e2.z - e1.z * e2.y, e1.z * e2.x - e1.x * e2.z, e1.x * e2.y - e1.y * e2.x);
+        r |= assert(cross == quad.normal());
+    }
+
+    // Greedy Merging and Culling
+    Level3D slab = Level3D(LevelZ::parseLines({
+        "@type 3",
+        "---",
+        "stone: (0, 7, 0, 0, 0, 7)^[0, 0, 0]"
+    }));
+
+    LevelZ::GreedyMesher m2(slab);
+    m2.update(2);
+    r |= assert(m2.quads() == 6);
+
+    LevelZ::MeshBuffers b2 = m2.buffers();
+    r |= assert(b2.positions.size() == 6 * 4 * 3);
+    r |= assert(b2.normals.size() == b2.positions.size());
+    r |= assert(b2.materials.size() == 6 * 4);
+    r |= assert(b2.indices.size() == 6 * 6);
+
+    // Materials
+    Level3D striped = Level3D(LevelZ::parseLines({
+        "@type 3",
+        "---",
+        "stone: (0, 3, 0, 0, 0, 3)^[0, 0, 0]",
+        "grass: (0, 3, 1, 1, 0, 3)^[0, 0, 0]"
+    }));
+
+    LevelZ::GreedyMesher m3(striped);
+    m3.update();
+    r |= assert(m3.materials().size() == 2);
+    r |= assert(m3.quads() == 10);
+
+    size_t top = 0;
+    for (const LevelZ::MeshQuad& quad : *m3.chunk(0, 0, 0))
+        if (quad.axis == 1 && quad.positive) {
+            top++;
+            r |= assert(m3.materials()[quad.material].name == "grass");
+            r |= assert(quad.origin[1] == 2 && quad.width * quad.height == 16);
+        }
+
+    r |= assert(top == 1);
+
+    // Chunk Boundaries
+    Level3D bar = Level3D(LevelZ::parseLines({
+        "@type 3",
+        "---",
+        "stone: (0, 31, 0, 0, 0, 0)^[0, 0, 0]"
+    }));
+
+    LevelZ::GreedyMesher m4(bar);
+    r |= assert(m4.update() == 2);
+    r |= assert(m4.chunks().size() == 2);
+    r |= assert(m4.quads() == 10);
+
+    // Incremental Updates
+    r |= assert(m4.erase(16, 0, 0));
+    r |= assert(!m4.erase(16, 0, 0));
+    r |= assert(m4.dirty() == 2);
+    r |= assert(m4.update() == 2);
+    r |= assert(m4.quads() == 12);
+
+    m4.set(5, 0, 0, Block("grass"));
+    r |= assert(m4.dirty() == 1);
+    m4.update();
+    r |= assert(m4.quads() == 20);
+
+    for (int x = 17; x < 32; x++) m4.erase(x, 0, 0);
+    m4.update();
+    r |= assert(m4.chunks().size() == 1);
+    r |= assert(m4.chunk(1, 0, 0) == nullptr);
+
+    return r;
+}
@@ -0,0 +1,87 @@
+#include <iostream>
+#include <vector>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    // a wall at x = 3 with a gap at y = 4, and a closed room around (8, 1)
+    Level2D level = Level2D(LevelZ::parseLines({
+        "@type 2",
+        "---",
+        "stone: (0, 0, 0, 3, 0, 0)^[3, 0]",
+        "stone: [3, 5]",
+        "stone: (0, 2, 0, 0, 0, 0)^[7, 0]*(0, 2, 0, 0, 0, 0)^[7, 2]",
+        "stone: [7, 1]*[9, 1]",
+        "air: [0, 0]"
+    }));
+
+    LevelZ::NavigationGrid2D grid(level, 0, [](const Block& block) { return block.name != "air"; });
+    r |= assert(grid.x() == 0 && grid.y() == 0);
+    r |= assert(grid.width() == 10 && grid.height() == 6);
+
+    // Walkable Cells
+    r |= assert(grid.walkable(0, 0));
+    r |= assert(!grid.walkable(3, 2));
+    r |= assert(grid.walkable(3, 4));
+    r |= assert(!grid.walkable(8, 0));
+    r |= assert(grid.walkable(8, 1));
+    r |= assert(!grid.walkable(-1, 0));
+    r |= assert(!grid.walkable(10, 0));
+
+    // Components
+    r |= assert(grid.components() == 2);
+    r |= assert(grid.connected(0, 0, 5, 0));
+    r |= assert(!grid.connected(0, 0, 8, 1));
+    r |= assert(grid.component(3, 0) == 0);
+    r |= assert(grid.component(8, 1) != 0);
+
+    // Paths
+    std::vector<Coordinate2D> p1 = grid.path(2, 0, 4, 0);
+    r |= assert(p1.size() == 11);
+    r |= assert(p1.front() == Coordinate2D(2.0, 0.0) && p1.back() == Coordinate2D(4.0, 0.0));
+    for (size_t i = 1; i < p1.size(); i++) {
+        r |= assert(std::abs(p1[i].x - p1[i - 1].x) + std::abs(p1[i].y - p1[i - 1].y) == 1);
+        r |= assert(grid.walkable(static_cast<int>(p1[i].x), static_cast<int>(p1[i].y)));
+    }
+
+    r |= assert(grid.path(Coordinate2D(2.5, 0.5), Coordinate2D(4.5, 0.5)) == p1);
+    r |= assert(grid.path(2, 0, 4, 0, true).size() == 11);
+    r |= assert(grid.path(0, 0, 8, 1).empty());
+    r |= assert(grid.path(0, 0, 3, 0).empty());
+    r |= assert(grid.path(1, 1, 1, 1).size() == 1);
+
+    // Incremental Updates
+    grid.setWalkable(3, 4, false);
+    r |= assert(grid.components() == 3);
+    r |= assert(!grid.connected(2, 0, 4, 0));
+    r |= assert(grid.path(2, 0, 4, 0).empty());
+
+    grid.remove(LevelObject(Block("stone"), Coordinate2D(8.0, 2.0)));
+    r |= assert(grid.connected(4, 0, 8, 1));
+    r |= assert(grid.components() == 2);
+
+    grid.place(LevelObject(Block("stone"), Coordinate2D(8.0, 2.0)));
+    r |= assert(!grid.connected(4, 0, 8, 1));
+
+    LevelZ::LevelDiff diff;
+    diff.removed.push_back(LevelObject(Block("stone"), Coordinate2D(3.0, 1.0)));
+    diff.added.push_back(LevelObject(Block("stone"), Coordinate2D(0.0, 0.0)));
+    grid.apply(diff);
+    r |= assert(!grid.walkable(0, 0));
+    r |= assert(grid.path(2, 1, 4, 1).size() == 3);
+
+    // Empty Grids
+    LevelZ::NavigationGrid2D empty(0, 0, 5, 5);
+    r |= assert(empty.components() == 1);
+    r |= assert(empty.path(0, 0, 4, 4, true).size() == 5);
+
+    try {
+        LevelZ::NavigationGrid2D invalid(level, -1);
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    return r;
+}
@@ -0,0 +1,97 @@
+#include <iostream>
+#include <memory>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    // 2D Instances
+    std::shared_ptr<const Level> house = LevelZ::share(Level2D({{"type", "2"}}, {
+        LevelObject(Block("wall"), Coordinate2D(0.0, 0.0)),
+        LevelObject(Block("wall"), Coordinate2D(1.0, 0.0)),
+        LevelObject(Block("door"), Coordinate2D(0.0, 1.0))
+    }));
+
+    LevelZ::InstancedLevel l1;
+    r |= assert(l1.is2D());
+    r |= assert(l1.place(house, Coordinate2D(0.0, 0.0)) == 0);
+    r |= assert(l1.place(house, Coordinate2D(10.0, 5.0)) == 1);
+    r |= assert(l1.place(house, Coordinate2D(1.0, 0.0)) == 2);
+    l1.add(LevelObject(Block("grass"), Coordinate2D(20.0, 20.0)));
+
+    r |= assert(l1.instances().size() == 3);
+    r |= assert(l1.size() == 10);
+    r |= assert(l1.instances()[1].min() == Coordinate3D(10.0, 5.0, 0.0));
+    r |= assert(l1.instances()[1].max() == Coordinate3D(11.0, 6.0, 0.0));
+
+    r |= assert(l1.find(Coordinate2D(10.0, 6.0))->name == "door");
+    r |= assert(l1.find(Coordinate2D(11.0, 5.0))->name == "wall");
+    r |= assert(l1.find(Coordinate2D(1.0, 1.0))->name == "door");
+    r |= assert(l1.find(Coordinate2D(20.0, 20.0))->name == "grass");
+    r |= assert(l1.find(Coordinate2D(5.0, 5.0)) == nullptr);
+
+    // blocks are shared with the prefab, not copied
+    r |= assert(l1.find(Coordinate2D(10.0, 5.0)) == &house->blocks()[0].block());
+
+    size_t visited = 0;
+    l1.forEach([&visited](const Block&, const Coordinate3D&) { visited++; });
+    r |= assert(visited == l1.size());
+
+    // Flatten
+    Level flat = l1.flatten();
+    r |= assert(flat.blocks().size() == 9);
+    r |= assert(flat.header().is2D());
+    r |= assert(flat == Level2D({{"type", "2"}}, {
+        LevelObject(Block("wall"), Coordinate2D(0.0, 0.0)),
+        LevelObject(Block("door"), Coordinate2D(0.0, 1.0)),
+        LevelObject(Block("wall"), Coordinate2D(10.0, 5.0)),
+        LevelObject(Block("wall"), Coordinate2D(11.0, 5.0)),
+        LevelObject(Block("door"), Coordinate2D(10.0, 6.0)),
+        LevelObject(Block("wall"), Coordinate2D(1.0, 0.0)),
+        LevelObject(Block("wall"), Coordinate2D(2.0, 0.0)),
+        LevelObject(Block("door"), Coordinate2D(1.0, 1.0)),
+        LevelObject(Block("grass"), Coordinate2D(20.0, 20.0))
+    }));
+
+    r |= assert(l1.remove(house) == 3);
+    r |= assert(l1.size() == 1);
+    r |= assert(l1.find(Coordinate2D(0.0, 0.0)) == nullptr);
+
+    // 3D Instances
+    std::shared_ptr<const Level> tree = LevelZ::share(LevelZ::parseLines({
+        "@type 3",
+        "---",
+        "log: [0, 0, 0]*[0, 1, 0]",
+        "leaves: [0, 2, 0]"
+    }));
+
+    LevelZ::InstancedLevel l2(Level3D({{"type", "3"}}, {
+        LevelObject(Block("dirt"), Coordinate3D(4.0, 0.0, 4.0))
+    }));
+    r |= assert(!l2.is2D());
+    for (int i = 0; i < 100; i++)
+        l2.place(tree, Coordinate3D(static_cast<double>(i * 4), 1.0, 4.0));
+
+    r |= assert(l2.size() == 301);
+    r |= assert(l2.find(Coordinate3D(396.0, 3.0, 4.0))->name == "leaves");
+    r |= assert(l2.find(Coordinate3D(4.0, 0.0, 4.0))->name == "dirt");
+    r |= assert(l2.find(Coordinate3D(4.0, 1.0, 4.0))->name == "log");
+    r |= assert(l2.find(Coordinate3D(5.0, 1.0, 4.0)) == nullptr);
+    r |= assert(l2.flatten().blocks().size() == 301);
+    r |= assert(static_cast<Level3D>(l2.flatten()).blocks()[300].block().name == "dirt");
+
+    // Errors
+    try {
+        l2.place(house, Coordinate3D(0.0, 0.0, 0.0));
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    try {
+        l1.place(nullptr, Coordinate2D(0.0, 0.0));
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    return r;
+}
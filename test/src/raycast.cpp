@@ -0,0 +1,84 @@
+#include <iostream>
+#include <vector>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    Level3D level = Level3D(LevelZ::parseLines({
+        "@type 3",
+        "---",
+        "stone: (0, 9, 0, 0, 0, 9)^[0, 0, 0]",
+        "wall: (5, 5, 1, 3, 0, 9)^[0, 0, 0]",
+        "target: [8, 1, 4]"
+    }));
+
+    LevelZ::Raycaster caster(level);
+    r |= assert(caster.world().size() == level.blocks().size());
+
+    // Single Rays
+    LevelZ::RayHit h1 = caster.cast(Coordinate3D(1.5, 1.5, 4.5), Coordinate3D(1.0, 0.0, 0.0));
+    r |= assert(h1.hit());
+    r |= assert(h1.block->name == "wall");
+    r |= assert(h1.coordinate == Coordinate3D(5.0, 1.0, 4.0));
+    r |= assert(h1.normal == Coordinate3D(-1.0, 0.0, 0.0));
+    r |= assert(std::abs(h1.distance - 3.5) < 1e-9);
+
+    LevelZ::RayHit h2 = caster.cast(Coordinate3D(2.5, 5.5, 2.5), Coordinate3D(0.0, -2.0, 0.0));
+    r |= assert(h2 && h2.block->name == "stone");
+    r |= assert(h2.coordinate == Coordinate3D(2.0, 0.0, 2.0));
+    r |= assert(h2.normal == Coordinate3D(0.0, 1.0, 0.0));
+    r |= assert(std::abs(h2.distance - 4.5) < 1e-9);
+
+    LevelZ::RayHit h3 = caster.cast(Coordinate3D(9.5, 1.5, 4.5), Coordinate3D(-1.0, 0.0, 0.0));
+    r |= assert(h3.block->name == "target");
+    r |= assert(h3.normal == Coordinate3D(1.0, 0.0, 0.0));
+
+    // diagonal ray into the wall
+    LevelZ::RayHit h4 = caster.cast(Coordinate3D(1.5, 1.5, 4.5), Coordinate3D(1.0, 0.3, 0.0), 100.0);
+    r |= assert(h4.block->name == "wall");
+    r |= assert(h4.coordinate.x == 5.0 && h4.coordinate.y >= 1.0 && h4.coordinate.y <= 3.0);
+
+    LevelZ::RayHit h5 = caster.cast(Coordinate3D(1.5, 4.5, 4.5), Coordinate3D(0.0, 1.0, 0.0));
+    r |= assert(!h5.hit());
+
+    LevelZ::RayHit h6 = caster.cast(Coordinate3D(1.5, 1.5, 4.5), Coordinate3D(1.0, 0.0, 0.0), 3.0);
+    r |= assert(!h6);
+
+    LevelZ::RayHit h7 = caster.cast(Coordinate3D(5.5, 2.5, 4.5), Coordinate3D(1.0, 0.0, 0.0));
+    r |= assert(h7.block->name == "wall");
+    r |= assert(h7.distance == 0 && h7.normal == Coordinate3D(0.0, 0.0, 0.0));
+
+    // Batches
+    std::vector<LevelZ::Ray> rays;
+    for (int i = 0; i < 2000; i++)
+        rays.push_back(LevelZ::Ray(Coordinate3D(1.5, 1.5 + (i % 3), 0.5 + (i % 10)), Coordinate3D(1.0, 0.0, 0.0)));
+
+    std::vector<LevelZ::RayHit> hits = caster.cast(rays, 4);
+    r |= assert(hits.size() == rays.size());
+    for (size_t i = 0; i < hits.size(); i++)
+        r |= assert(hits[i].coordinate == caster.cast(rays[i]).coordinate && hits[i].block->name == "wall");
+
+    // Line of Sight
+    r |= assert(caster.visible(Coordinate3D(1.5, 1.5, 4.5), Coordinate3D(4.5, 2.5, 7.5)));
+    r |= assert(!caster.visible(Coordinate3D(1.5, 1.5, 4.5), Coordinate3D(8.5, 1.5, 4.5)));
+    r |= assert(caster.visible(Coordinate3D(1.5, 1.5, 4.5), Coordinate3D(5.5, 1.5, 4.5)));
+    r |= assert(caster.visible(Coordinate3D(6.5, 1.5, 4.5), Coordinate3D(8.5, 1.5, 4.5)));
+    r |= assert(caster.visible(Coordinate3D(5.5, 1.5, 4.5), Coordinate3D(5.5, 1.5, 4.5)));
+    r |= assert(caster.visible(Coordinate3D(1.5, 1.5, 4.5), Coordinate3D(1.5, 8.5, 4.5)));
+
+    // Errors
+    try {
+        caster.cast(Coordinate3D(0.0, 0.0, 0.0), Coordinate3D(0.0, 0.0, 0.0));
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    try {
+        caster.cast(std::vector<LevelZ::Ray>(1000, LevelZ::Ray(Coordinate3D(0.0, 0.0, 0.0), Coordinate3D(1.0, 0.0, 0.0), -1.0)), 2);
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    return r;
+}
@@ -0,0 +1,101 @@
+#include <iostream>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include <filesystem>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    const std::filesystem::path root = std::filesystem::temp_directory_path() / "levelz-test-registry";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+
+    const std::string a = (root / "a.lvlz").string();
+    const std::string b = (root / "b.lvlz").string();
+    const std::string c = (root / "c.lvlz").string();
+    std::ofstream(a) << "@type 2\n@scroll vertical-up\n---\ngrass: [0, 0]*[1, 0]\nend\n";
+    std::ofstream(b) << "@type 3\n@spawn [1, 2, 3]\n---\nstone: (0, 9, 0, 9, 0, 0)^[0, 0, 0]\nend\n";
+    std::ofstream(c) << "@type 2\n---\nwater: [0, 0]\nend\n";
+
+    // Shared Snapshots
+    LevelZ::LevelRegistry registry;
+    std::shared_ptr<const Level2D> l1 = registry.get2D(a);
+    r |= assert(l1->blocks().size() == 2);
+    r |= assert(l1->scroll() == Scroll::VERTICAL_UP);
+    r |= assert(registry.get(a) == l1);
+    r |= assert(registry.misses() == 1 && registry.hits() == 1);
+
+    std::shared_ptr<const Level3D> l2 = registry.get3D(b);
+    r |= assert(l2->blocks().size() == 100);
+    r |= assert(l2->spawn == Coordinate3D(1, 2, 3));
+    r |= assert(registry.size() == 2);
+    r |= assert(registry.memory() > 100 * sizeof(LevelObject));
+
+    try {
+        registry.get3D(a);
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    // File Changes
+    std::ofstream(a) << "@type 2\n---\ngrass: [0, 0]\nend\n";
+    std::filesystem::last_write_time(a, std::filesystem::last_write_time(a) + std::chrono::seconds(5));
+
+    std::shared_ptr<const Level2D> l3 = registry.get2D(a);
+    r |= assert(l3 != l1);
+    r |= assert(l3->blocks().size() == 1);
+    r |= assert(l1->blocks().size() == 2);
+
+    r |= assert(registry.invalidate(a));
+    r |= assert(!registry.contains(a));
+    r |= assert(!registry.invalidate(a));
+    r |= assert(registry.get2D(a) != l3);
+
+    // Coalesced Loads
+    registry.clear();
+    r |= assert(registry.size() == 0 && registry.memory() == 0);
+
+    size_t misses = registry.misses();
+    std::vector<std::shared_ptr<const Level>> results(8);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < results.size(); i++)
+        threads.emplace_back([&registry, &results, &b, i]() {
+            results[i] = registry.get(b);
+        });
+
+    for (std::thread& t : threads) t.join();
+
+    for (const auto& result : results)
+        r |= assert(result == results[0]);
+    r |= assert(registry.misses() == misses + 1);
+
+    // Eviction
+    LevelZ::RegistryOptions options;
+    options.budget = LevelZ::estimateMemory(*registry.get(a)) + LevelZ::estimateMemory(*registry.get(c));
+    LevelZ::LevelRegistry small(options);
+
+    small.get(a);
+    small.get(c);
+    r |= assert(small.size() == 2 && small.evictions() == 0);
+
+    small.get(a);
+    std::shared_ptr<const Level3D> l4 = small.get3D(b);
+    r |= assert(small.evictions() >= 1);
+    r |= assert(!small.contains(c));
+    r |= assert(small.contains(b));
+    r |= assert(l4->blocks().size() == 100);
+
+    // Missing Files
+    try {
+        registry.get((root / "missing.lvlz").string());
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+    r |= assert(!registry.contains((root / "missing.lvlz").string()));
+
+    std::filesystem::remove_all(root);
+
+    return r;
+}
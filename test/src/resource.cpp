@@ -0,0 +1,89 @@
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <memory_resource>
+
+#include "test.h"
+#include "levelz.hpp"
+
+struct CountingResource : std::pmr::memory_resource {
+    size_t allocations = 0;
+    size_t bytes = 0;
+
+    void* do_allocate(size_t size, size_t alignment) override {
+        allocations++;
+        bytes += size;
+        return std::pmr::new_delete_resource()->allocate(size, alignment);
+    }
+
+    void do_deallocate(void* p, size_t size, size_t alignment) override {
+        bytes -= size;
+        std::pmr::new_delete_resource()->deallocate(p, size, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+int main() {
+    int r = 0;
+
+    std::string contents = "@type 2\r\n---\r\ngrass<type=1>: [0, 0]*(0, 1, 0, 1)^[4, 4]\nstone: [0, 1] # Comment\nend\n";
+
+    // Blocks and temporaries come from the resource
+    CountingResource counting;
+    LevelZ::ParseOptions options;
+    options.resource = &counting;
+
+    {
+        Level l1 = LevelZ::parseContents(contents, options);
+        r |= assert(l1.resource() == &counting);
+        r |= assert(l1.blocks().size() == 6);
+        r |= assert(l1.blocks()[0].block().getInt("type") == 1);
+        r |= assert(counting.allocations > 0);
+        r |= assert(counting.bytes > 0);
+
+        // Copies use the default resource
+        Level2D l2 = static_cast<Level2D>(l1);
+        r |= assert(l2.resource() == std::pmr::get_default_resource());
+        r |= assert(l2 == l1);
+        r |= assert(l2.spawn == Coordinate2D(0, 0));
+    }
+
+    r |= assert(counting.bytes == 0);
+
+    // Without a resource
+    Level l3 = LevelZ::parseContents(contents);
+    r |= assert(l3.resource() == std::pmr::get_default_resource());
+    r |= assert(l3.blocks().size() == 6);
+
+    // Monotonic arena, released at once
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        options.resource = &arena;
+
+        Level l4 = LevelZ::parseLines({"@type 3", "---", "stone: [0, 0, 0]*(0, 1, 0, 1, 0, 1)^[1, 1, 1]"}, options);
+        r |= assert(l4.blocks().size() == 9);
+        r |= assert(l4.resource() == &arena);
+        r |= assert(Level3D(l4).blocks()[1].coordinate3D() == Coordinate3D(1, 1, 1));
+    }
+
+    // Files
+    const std::string file = (std::filesystem::temp_directory_path() / "levelz-test-resource.lvlz").string();
+    std::ofstream(file) << contents;
+
+    counting.allocations = 0;
+    options.resource = &counting;
+    {
+        Level l5 = LevelZ::parseFile(file, options);
+        r |= assert(l5.blocks().size() == 6);
+        r |= assert(l5 == l3);
+        r |= assert(counting.allocations > 0);
+    }
+    std::filesystem::remove(file);
+
+    r |= assert(counting.bytes == 0);
+
+    return r;
+}
@@ -0,0 +1,89 @@
+#include <iostream>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    LevelZ::SharedLevel level(LevelZ::parseLines({"@type 2", "@spawn [1, 1]", "---", "grass: [0, 0]*[1, 0]"}));
+    r |= assert(level.version() == 0);
+
+    std::shared_ptr<const Level2D> s1 = level.snapshot2D();
+    r |= assert(s1->blocks().size() == 2);
+    r |= assert(s1->spawn == Coordinate2D(1, 1));
+
+    try {
+        level.snapshot3D();
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    // Batched Edits
+    LevelZ::LevelDiff diff;
+    diff.added.push_back(LevelObject(Block("stone"), Coordinate2D(5, 5)));
+    diff.removed.push_back(LevelObject(Block("grass"), Coordinate2D(1, 0)));
+    diff.headersSet["scroll"] = "horizontal-left";
+
+    std::shared_ptr<const Level> s2 = level.apply(diff);
+    r |= assert(level.version() == 1);
+    r |= assert(level.snapshot() == s2);
+    r |= assert(s2->blocks().size() == 2);
+    r |= assert(level.snapshot2D()->scroll() == Scroll::HORIZONTAL_LEFT);
+
+    // Old snapshots are unchanged
+    r |= assert(s1->blocks().size() == 2);
+    r |= assert(s1->blocks()[1].coordinate2D() == Coordinate2D(1, 0));
+    r |= assert(s1->scroll() == Scroll::NONE);
+
+    level.update([](const Level& current) {
+        LevelZ::LevelDiff d;
+        d.headersSet["spawn"] = "[3, 4]";
+        return LevelZ::patch(current, d);
+    });
+    r |= assert(level.snapshot2D()->spawn == Coordinate2D(3, 4));
+    r |= assert(level.version() == 2);
+
+    level.replace(Level3D({{"type", "3"}}, {LevelObject(Block("air"), Coordinate3D(0, 0, 1))}));
+    r |= assert(level.snapshot3D()->blocks().size() == 1);
+    r |= assert(level.version() == 3);
+
+    // Concurrent Readers and Editors
+    LevelZ::SharedLevel shared(Level2D({}, {}));
+    std::atomic<bool> running{true};
+    std::atomic<int> inconsistent{0};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; i++)
+        readers.emplace_back([&]() {
+            while (running.load()) {
+                std::shared_ptr<const Level> snapshot = shared.snapshot();
+                size_t size = snapshot->blocks().size();
+                for (size_t j = 0; j < size; j++)
+                    if (snapshot->blocks()[j].coordinate2D().x != static_cast<double>(j)) inconsistent++;
+            }
+        });
+
+    std::vector<std::thread> editors;
+    for (int e = 0; e < 2; e++)
+        editors.emplace_back([&shared]() {
+            for (int i = 0; i < 50; i++)
+                shared.update([](const Level& current) {
+                    std::vector<LevelObject> blocks(current.blocks().begin(), current.blocks().end());
+                    blocks.push_back(LevelObject(Block("stone"), Coordinate2D(static_cast<double>(blocks.size()), 0.0)));
+                    return Level2D(current.headers(), blocks);
+                });
+        });
+
+    for (std::thread& t : editors) t.join();
+    running = false;
+    for (std::thread& t : readers) t.join();
+
+    r |= assert(inconsistent.load() == 0);
+    r |= assert(shared.version() == 100);
+    r |= assert(shared.snapshot()->blocks().size() == 100);
+
+    return r;
+}
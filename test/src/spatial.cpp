@@ -0,0 +1,111 @@
+#include <iostream>
+#include <random>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    // Morton Codes
+    r |= assert(LevelZ::mortonEncode2D(0, 0) == 0);
+    r |= assert(LevelZ::mortonEncode2D(1, 0) == 1);
+    r |= assert(LevelZ::mortonEncode2D(0, 1) == 2);
+    r |= assert(LevelZ::mortonEncode2D(3, 3) == 15);
+    r |= assert(LevelZ::mortonEncode2D(0xFFFFFFFF, 0) == 0x5555555555555555ULL);
+    r |= assert(LevelZ::mortonEncode3D(1, 1, 1) == 7);
+    r |= assert(LevelZ::mortonEncode3D(2, 0, 0) == 8);
+    r |= assert(LevelZ::mortonEncode3D(0x1FFFFF, 0, 0) == 0x1249249249249249ULL);
+
+    // Radix Sort
+    for (size_t threads : {1, 4}) {
+        std::mt19937_64 random(43);
+        std::vector<uint64_t> keys(200000);
+        std::vector<size_t> values(keys.size());
+        for (size_t i = 0; i < keys.size(); i++) {
+            keys[i] = random() % 5000;
+            values[i] = i;
+        }
+
+        std::vector<uint64_t> original = keys;
+        LevelZ::radixSort(keys, values, threads);
+
+        bool sorted = true;
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (original[values[i]] != keys[i]) sorted = false;
+            if (i > 0 && (keys[i - 1] > keys[i] || (keys[i - 1] == keys[i] && values[i - 1] > values[i]))) sorted = false;
+        }
+
+        r |= assert(sorted);
+    }
+
+    // Sorting Levels
+    LevelZ::GeneratorOptions generator;
+    generator.lines = 3000;
+    generator.seed = 43;
+    const std::string contents = LevelZ::generateContents(generator);
+    const Level expected = LevelZ::parseContents(contents);
+
+    Level sorted = expected;
+    LevelZ::sortMorton(sorted, 2);
+    r |= assert(sorted == expected);
+    r |= assert(sorted.blocks().size() == expected.blocks().size());
+
+    LevelZ::ParseOptions options;
+    options.spatialOrder = true;
+    Level parsed = LevelZ::parseContents(contents, options);
+    r |= assert(parsed == expected);
+    r |= assert(parsed.blocks() == sorted.blocks());
+
+    Level2D grid = Level2D(LevelZ::parseLines({"@type 2", "---", "a: [1, 1]*[0, 0]*[1, 0]*[0, 1]*[-1, -1]"}));
+    LevelZ::sortMorton(grid);
+    r |= assert(grid.blocks()[0].coordinate2D() == Coordinate2D(-1.0, -1.0));
+    r |= assert(grid.blocks()[1].coordinate2D() == Coordinate2D(0.0, 0.0));
+    r |= assert(grid.blocks()[2].coordinate2D() == Coordinate2D(1.0, 0.0));
+    r |= assert(grid.blocks()[3].coordinate2D() == Coordinate2D(0.0, 1.0));
+    r |= assert(grid.blocks()[4].coordinate2D() == Coordinate2D(1.0, 1.0));
+
+    // Cells are visited in Morton order, grouping blocks within each cell
+    std::vector<LevelObject> cells = {
+        LevelObject(Block("b"), Coordinate3D(20.0, 0.0, 0.0)),
+        LevelObject(Block("a"), Coordinate3D(1.0, 0.0, 0.0)),
+        LevelObject(Block("b"), Coordinate3D(0.0, 0.0, 0.0)),
+        LevelObject(Block("a"), Coordinate3D(0.0, 0.0, 1.0)),
+        LevelObject(Block("b"), Coordinate3D(0.0, 1.0, 0.0))
+    };
+    LevelZ::sortMorton(cells);
+    r |= assert(cells[0].block().name == "b" && cells[0].coordinate3D() == Coordinate3D(0.0, 0.0, 0.0));
+    r |= assert(cells[1].block().name == "b" && cells[1].coordinate3D() == Coordinate3D(0.0, 1.0, 0.0));
+    r |= assert(cells[2].block().name == "a" && cells[2].coordinate3D() == Coordinate3D(1.0, 0.0, 0.0));
+    r |= assert(cells[3].block().name == "a" && cells[3].coordinate3D() == Coordinate3D(0.0, 0.0, 1.0));
+    r |= assert(cells[4].coordinate3D() == Coordinate3D(20.0, 0.0, 0.0));
+    r |= assert(LevelZ::blockRuns(cells).size() == 3);
+
+    // Blocks of the same block at the same coordinate keep their order
+    std::vector<LevelObject> same = {
+        LevelObject(Block("a", {{"n", "1"}}), Coordinate3D(5.0, 5.0, 5.0)),
+        LevelObject(Block("b"), Coordinate3D(0.0, 0.0, 0.0)),
+        LevelObject(Block("a", {{"n", "1"}}), Coordinate3D(5.5, 5.0, 5.0))
+    };
+    LevelZ::sortMorton(same);
+    r |= assert(same[0].coordinate3D() == Coordinate3D(5.0, 5.0, 5.0));
+    r |= assert(same[1].coordinate3D() == Coordinate3D(5.5, 5.0, 5.0));
+    r |= assert(same[2].block().name == "b");
+
+    // Runs
+    std::vector<LevelZ::BlockRun> runs = LevelZ::blockRuns(LevelZ::parseLines({"@type 2", "---", "a: [0, 0]*[1, 0]", "b: [2, 0]", "a: [3, 0]"}).blocks());
+    r |= assert(runs.size() == 3);
+    r |= assert(runs[0].offset == 0 && runs[0].length == 2);
+    r |= assert(runs[1].offset == 2 && runs[1].length == 1);
+    r |= assert(runs[2].offset == 3 && runs[2].length == 1);
+    r |= assert(LevelZ::blockRuns(std::vector<LevelObject>()).empty());
+
+    size_t total = 0;
+    for (const LevelZ::BlockRun& run : LevelZ::blockRuns(parsed.blocks())) total += run.length;
+    r |= assert(total == parsed.blocks().size());
+
+    // Serialized runs
+    r |= assert(LevelZ::deserializeLevel(LevelZ::serializeLevel(parsed)) == expected);
+
+    return r;
+}
@@ -0,0 +1,84 @@
+#include <iostream>
+#include <string_view>
+
+#include "test.h"
+#include "levelz.hpp"
+
+constexpr std::string_view LEVEL_2D = "@type 2\n@spawn [1, 2]\n---\n# comment\ngrass: [0, 0]*[1, 0]\nstone<type=granite, hard=true>: (0, 1, 0, 1, 1, 1)^[2, 2]\nend\nignored: [9, 9]";
+constexpr std::string_view LEVEL_3D = "@type 3\n---\nstone: [0, 0, 0]*[1.5, -2, 3e1] # trailing\nair: (0, 1, 0, 0, 0, 1)^[0, 0, 0]";
+
+int main() {
+    int r = 0;
+
+    // Compile Time
+    constexpr Coordinate2D c2 = Coordinate2D::parse("[1.5, -2]");
+    static_assert(c2 == Coordinate2D(1.5, -2.0));
+    static_assert(Coordinate3D::parse("[1, 2e2, -0.25]") == Coordinate3D(1.0, 200.0, -0.25));
+    static_assert(CoordinateMatrix2D::parse("(0, 1, 0, 2, 1, 1)^[2, 2]").size() == 6);
+
+    constexpr StaticBlock block = StaticBlock::parse(" stone<type=granite, hard=true> ");
+    static_assert(block.name == "stone");
+    static_assert(block.property("type") == "granite");
+    static_assert(block.property("hard") == "true");
+    static_assert(block.property("missing").empty());
+
+    constexpr size_t count2D = countObjects(LEVEL_2D);
+    static_assert(count2D == 6);
+    static_assert(countHeaders(LEVEL_2D) == 2);
+
+    constexpr auto level2D = parseStatic<count2D>(LEVEL_2D);
+    static_assert(level2D.is2D);
+    static_assert(level2D.size() == 6);
+    static_assert(level2D.header("type") == "2");
+    static_assert(level2D.spawn() == Coordinate3D(1.0, 2.0, 0.0));
+    static_assert(level2D[0].block.name == "grass");
+    static_assert(level2D[2].block.property("type") == "granite");
+    static_assert(level2D[2].coordinate == Coordinate3D(2.0, 2.0, 0.0));
+    static_assert(level2D[5].coordinate == Coordinate3D(3.0, 3.0, 0.0));
+
+    constexpr auto level3D = parseStatic<countObjects(LEVEL_3D)>(LEVEL_3D);
+    static_assert(!level3D.is2D);
+    static_assert(level3D.size() == 6);
+    static_assert(level3D[1].coordinate == Coordinate3D(1.5, -2.0, 30.0));
+    static_assert(level3D[3].coordinate == Coordinate3D(0.0, 0.0, 1.0));
+    static_assert(level3D[5].coordinate == Coordinate3D(1.0, 0.0, 1.0));
+
+#if __cplusplus >= 202002L
+    constexpr auto& literal = static_level<"@type 2\n---\ngrass: [0, 0]*[4, 5]">;
+    static_assert(literal.size() == 2);
+    static_assert(literal[1].coordinate == Coordinate3D(4.0, 5.0, 0.0));
+#endif
+
+    // Runtime Equivalence
+    Level runtime2D = parseContents(std::string(LEVEL_2D));
+    Level static2D = level2D.toLevel();
+    r |= assert(static2D.headers() == runtime2D.headers());
+    r |= assert(static2D.blocks().size() == runtime2D.blocks().size());
+    for (size_t i = 0; i < static2D.blocks().size(); i++)
+        r |= assert(static2D.blocks()[i] == runtime2D.blocks()[i]);
+
+    Level runtime3D = parseContents(std::string(LEVEL_3D));
+    Level static3D = level3D.toLevel();
+    r |= assert(static3D.headers() == runtime3D.headers());
+    r |= assert(static3D.blocks().size() == runtime3D.blocks().size());
+    for (size_t i = 0; i < static3D.blocks().size(); i++)
+        r |= assert(static3D.blocks()[i] == runtime3D.blocks()[i]);
+
+    // Errors
+    try {
+        parseStatic<0>("grass: [0, 0]");
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    try {
+        parseStatic<1>("@type 2\n---\ngrass: [0, 0]*[1, 1]");
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    try {
+        Coordinate2D::parse("[1, x]");
+        r |= 1;
+    } catch (const std::invalid_argument&) {}
+
+    return r;
+}
@@ -0,0 +1,76 @@
+#include <iostream>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    // Parsed 2D
+    Level2D l1 = Level2D(LevelZ::parseLines({
+        "@type 2",
+        "---",
+        "grass: [0, 0]*[-2, 5]",
+        "stone<type=granite>: (0, 9, 0, 4, 0, 0)^[10, 1]*[3, 3]",
+        "grass: (1, 2, 1, 2, 0, 0)^[0, 0]"
+    }));
+
+    const LevelZ::LevelStats& s1 = l1.stats();
+    r |= assert(s1.total == l1.blocks().size());
+    r |= assert(s1.total == 2 + 50 + 1 + 4);
+    r |= assert(s1.points == 3);
+    r |= assert(s1.matrices == 2);
+    r |= assert(s1.matrixCells == 54);
+    r |= assert(s1.count("grass") == 6);
+    r |= assert(s1.count("stone") == 51);
+    r |= assert(s1.count("dirt") == 0);
+    r |= assert(s1.min == Coordinate3D(-2.0, 0.0, 0.0));
+    r |= assert(s1.max == Coordinate3D(19.0, 5.0, 0.0));
+    r |= assert(s1.extent() == Coordinate3D(21.0, 5.0, 0.0));
+
+    // Scanning agrees with the parser
+    LevelZ::LevelStats scanned = LevelZ::LevelStats::of(l1.blocks());
+    r |= assert(scanned.total == s1.total);
+    r |= assert(scanned.counts == s1.counts);
+    r |= assert(scanned.min == s1.min && scanned.max == s1.max);
+    r |= assert(scanned.points == s1.total);
+    r |= assert(scanned.matrices == 0);
+
+    // Parsed 3D
+    Level3D l2 = Level3D(LevelZ::parseContents("@type 3\n---\nstone: (0, 1, 0, 1, 0, 1, 0, 0)^[0, 0, -4]\nair: [1.5, 2, 3]\nend\ndirt: [100, 100, 100]"));
+    const LevelZ::LevelStats& s2 = l2.stats();
+    r |= assert(s2.total == 9);
+    r |= assert(s2.matrixCells == 8);
+    r |= assert(s2.min == Coordinate3D(0.0, 0.0, -4.0));
+    r |= assert(s2.max == Coordinate3D(1.5, 2.0, 3.0));
+    r |= assert(s2.count("dirt") == 0);
+
+    // Deduplicated levels are counted again
+    LevelZ::ParseOptions options;
+    options.deduplicate = true;
+    Level l3 = LevelZ::parseLines({"@type 2", "---", "grass: (0, 1, 0, 1, 0, 0)^[0, 0]", "stone: [0, 0]"}, options);
+    r |= assert(l3.stats().total == 4);
+    r |= assert(l3.stats().count("grass") == 3);
+    r |= assert(l3.stats().count("stone") == 1);
+
+    // Constructed levels
+    Level2D l4 = Level2D({}, std::vector<LevelObject>());
+    r |= assert(l4.stats().empty());
+
+    Level2D l5 = Level2D({{"type", "2"}}, {LevelObject(Block("a"), Coordinate2D(3.0, -1.0))});
+    r |= assert(l5.stats().total == 1);
+    r |= assert(l5.stats().min == Coordinate3D(3.0, -1.0, 0.0));
+
+    // Streaming and incremental parsing
+    LevelZ::LevelParser parser;
+    parser.feed("@type 2\n---\ngrass: (0, 3, 0, 3, 0, 0)^[0, 0]\n");
+    r |= assert(parser.finish().stats().matrixCells == 16);
+
+    LevelZ::IncrementalLevel incremental({"@type 2", "---", "grass: [0, 0]", "stone: [5, 5]"});
+    r |= assert(incremental.level().stats().total == 2);
+    incremental.setLine(3, "stone: [5, 5]*[6, 6]");
+    r |= assert(incremental.level().stats().total == 3);
+    r |= assert(incremental.level().stats().max == Coordinate3D(6.0, 6.0, 0.0));
+
+    return r;
+}
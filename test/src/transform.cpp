@@ -0,0 +1,57 @@
+#include <iostream>
+#include <vector>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    std::vector<LevelZ::Coordinate2D> c2 = {{1, 2}, {-3, 4}, {5, -6}};
+    std::vector<LevelZ::Coordinate3D> c3 = {{1, 2, 3}, {-4, 5, 6}, {7, -8, 9}};
+
+    // #translate
+    LevelZ::translate(c2, LevelZ::Coordinate2D(1, 1));
+    r |= assert(c2[0] == LevelZ::Coordinate2D(2, 3) && c2[2] == LevelZ::Coordinate2D(6, -5));
+
+    LevelZ::translate(c3, LevelZ::Coordinate3D(1, 2, 3));
+    r |= assert(c3[0] == LevelZ::Coordinate3D(2, 4, 6) && c3[1] == LevelZ::Coordinate3D(-3, 7, 9) && c3[2] == LevelZ::Coordinate3D(8, -6, 12));
+
+    // #scale
+    LevelZ::scale(c2, LevelZ::Coordinate2D(-1, 2));
+    r |= assert(c2[1] == LevelZ::Coordinate2D(2, 10));
+
+    LevelZ::scale(c3, LevelZ::Coordinate3D(1.0, -1.0, 0.5));
+    r |= assert(c3[2] == LevelZ::Coordinate3D(8, 6, 6));
+
+    // #rotate90
+    std::vector<LevelZ::Coordinate2D> r2 = {{1, 0}, {2, 3}};
+    LevelZ::rotate90(r2.data(), r2.size(), 1);
+    r |= assert(r2[0] == LevelZ::Coordinate2D(0, 1) && r2[1] == LevelZ::Coordinate2D(-3, 2));
+    LevelZ::rotate90(r2.data(), r2.size(), -1);
+    r |= assert(r2[1] == LevelZ::Coordinate2D(2, 3));
+    LevelZ::rotate90(r2.data(), r2.size(), 2);
+    r |= assert(r2[1] == LevelZ::Coordinate2D(-2, -3));
+
+    std::vector<LevelZ::Coordinate3D> r3 = {{1, 0, 0}};
+    LevelZ::rotate90(r3.data(), r3.size(), LevelZ::Axis::Z, 1);
+    r |= assert(r3[0] == LevelZ::Coordinate3D(0, 1, 0));
+    LevelZ::rotate90(r3.data(), r3.size(), LevelZ::Axis::X, 1);
+    r |= assert(r3[0] == LevelZ::Coordinate3D(0, 0, 1));
+
+    // #bounds
+    LevelZ::Bounds2D b2 = LevelZ::bounds(std::vector<LevelZ::Coordinate2D>{{1, 5}, {-2, 3}, {4, -1}});
+    r |= assert(b2.min == LevelZ::Coordinate2D(-2, -1) && b2.max == LevelZ::Coordinate2D(4, 5));
+
+    LevelZ::Bounds3D b3 = LevelZ::bounds(std::vector<LevelZ::Coordinate3D>{{1, 5, 0}, {-2, 3, 9}, {4, -1, -7}});
+    r |= assert(b3.min == LevelZ::Coordinate3D(-2, -1, -7) && b3.max == LevelZ::Coordinate3D(4, 5, 9));
+
+    // #magnitudes
+    std::vector<double> m2 = LevelZ::magnitudes(std::vector<LevelZ::Coordinate2D>{{3, 4}, {1, 1}, {0, 2}});
+    r |= assert(m2[0] == 25 && m2[1] == 2 && m2[2] == 4);
+
+    std::vector<double> m3 = LevelZ::magnitudes(std::vector<LevelZ::Coordinate3D>{{3, 4, 5}});
+    r |= assert(m3[0] == 50);
+
+    return r;
+}
@@ -0,0 +1,98 @@
+#include <iostream>
+
+#include "test.h"
+#include "levelz.hpp"
+
+int main() {
+    int r = 0;
+
+    LevelZ::ChunkedWorld3D world;
+    r |= assert(world.size() == 0);
+    r |= assert(world.sections() == 0);
+    r |= assert(world.get(0, 0, 0) == nullptr);
+
+    // Get and Set
+    Block stone("stone");
+    Block grass("grass", {{"snowy", "true"}});
+
+    world.set(0, 0, 0, stone);
+    world.set(-1, -17, 33, grass);
+    r |= assert(world.size() == 2);
+    r |= assert(world.sections() == 2);
+    r |= assert(*world.get(0, 0, 0) == stone);
+    r |= assert(*world.get(-1, -17, 33) == grass);
+    r |= assert(*world.get(Coordinate3D(-0.5, -16.5, 33.9)) == grass);
+    r |= assert(world.get(1, 0, 0) == nullptr);
+    r |= assert(world.get(-1, -17, 32) == nullptr);
+
+    world.set(0, 0, 0, grass);
+    r |= assert(*world.get(0, 0, 0) == grass);
+    r |= assert(world.size() == 2);
+    r |= assert(world.palette().size() == 2);
+
+    r |= assert(world.erase(-1, -17, 33));
+    r |= assert(!world.erase(-1, -17, 33));
+    r |= assert(world.size() == 1);
+    r |= assert(world.sections() == 1);
+
+    // Widening palettes
+    LevelZ::ChunkedWorld3D mixed;
+    for (int i = 0; i < 300; i++)
+        mixed.set(i % 16, (i / 16) % 16, i / 256, Block("b" + std::to_string(i)));
+
+    r |= assert(mixed.size() == 300);
+    r |= assert(mixed.sections() == 1);
+    for (int i = 0; i < 300; i++)
+        r |= assert(mixed.get(i % 16, (i / 16) % 16, i / 256)->name == "b" + std::to_string(i));
+
+    for (int i = 2; i < 300; i++)
+        mixed.erase(i % 16, (i / 16) % 16, i / 256);
+
+    size_t before = mixed.memory();
+    mixed.compact();
+    r |= assert(mixed.memory() < before);
+    r |= assert(mixed.get(0, 0, 0)->name == "b0");
+    r |= assert(mixed.get(1, 0, 0)->name == "b1");
+    r |= assert(mixed.get(2, 0, 0) == nullptr);
+
+    // Bulk Fill
+    LevelZ::ChunkedWorld3D filled;
+    filled.fill(CoordinateMatrix3D(-5, 20, 0, 3, 10, 40, Coordinate3D(0.0, 0.0, 0.0)), stone);
+    r |= assert(filled.size() == 26 * 4 * 31);
+    r |= assert(filled.sections() == 3 * 1 * 3);
+    r |= assert(*filled.get(-5, 0, 10) == stone);
+    r |= assert(*filled.get(20, 3, 40) == stone);
+    r |= assert(filled.get(21, 3, 40) == nullptr);
+    r |= assert(filled.get(0, 4, 10) == nullptr);
+
+    filled.fill(CoordinateMatrix3D(0, 0, 0, 3, 10, 40, Coordinate3D(0.0, 0.0, 0.0)), grass);
+    r |= assert(filled.size() == 26 * 4 * 31);
+    r |= assert(*filled.get(0, 1, 20) == grass);
+
+    filled.erase(CoordinateMatrix3D(-5, 20, 0, 3, 10, 40, Coordinate3D(0.0, 0.0, 0.0)));
+    r |= assert(filled.size() == 0);
+    r |= assert(filled.sections() == 0);
+
+    // One bit per block for two-block sections
+    LevelZ::ChunkedWorld3D dense;
+    dense.fill(CoordinateMatrix3D(0, 255, 0, 255, 0, 15, Coordinate3D(0.0, 0.0, 0.0)), stone);
+    r |= assert(dense.size() == 256 * 256 * 16);
+    r |= assert(dense.memory() < dense.size());
+
+    // Levels
+    Level3D level = Level3D(LevelZ::parseLines({"@type 3", "---", "stone: (0, 3, 0, 3, 0, 3)^[0, 0, 0]", "grass: [1, 1, 1]*[100, -100, 7]"}));
+    LevelZ::ChunkedWorld3D fromLevel(level);
+    r |= assert(fromLevel.size() == 65);
+    r |= assert(*fromLevel.get(1, 1, 1) == Block("grass"));
+    r |= assert(*fromLevel.get(2, 1, 1) == Block("stone"));
+
+    size_t visited = 0;
+    fromLevel.forEach([&visited](int, int, int, const Block&) { visited++; });
+    r |= assert(visited == 65);
+
+    Level3D back = fromLevel.toLevel();
+    r |= assert(back.blocks().size() == 65);
+    r |= assert(LevelZ::ChunkedWorld3D(back).get(100, -100, 7)->name == "grass");
+
+    return r;
+}